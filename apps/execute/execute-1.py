@@ -36,6 +36,7 @@
 ##########################################################################
 
 import sys
+import json
 import pathlib
 import traceback
 
@@ -45,6 +46,8 @@ import IECore
 
 import Gaffer
 
+from GafferDispatch.LocalDispatcher import _workerResultPrefix
+
 class execute( Gaffer.Application ) :
 
 	def __init__( self ) :
@@ -62,6 +65,13 @@ class execute( Gaffer.Application ) :
 			```
 			gaffer execute -script comp.gfr -nodes ImageWriter -frames 1-10
 			```
+
+			Run as a worker, loading the script once and then executing
+			batches requested on `stdin` :
+
+			```
+			gaffer execute -script comp.gfr -worker
+			```
 			"""
 		)
 
@@ -111,6 +121,19 @@ class execute( Gaffer.Application ) :
 					},
 				),
 
+				IECore.BoolParameter(
+					name = "worker",
+					description = "Runs as a persistent worker process, which loads the script "
+						"once and then executes any number of batches. Each batch is requested "
+						"by writing a line of JSON to `stdin`, containing `nodes`, `frames` and "
+						"`context` entries equivalent to the parameters above. Completion of "
+						"each batch is reported by writing a newline followed by `" + _workerResultPrefix + "<returnCode>` "
+						"to `stdout`. Caches are cleared after each batch. The worker exits when `stdin` is closed. This is used by "
+						"the LocalDispatcher to avoid the cost of launching a process and loading "
+						"the script for every batch.",
+					defaultValue = False,
+				),
+
 			]
 
 		)
@@ -121,6 +144,8 @@ class execute( Gaffer.Application ) :
 			}
 		)
 
+		self.__connectedNodes = set()
+
 	def _run( self, args ) :
 
 		scriptNode = Gaffer.ScriptNode()
@@ -133,9 +158,34 @@ class execute( Gaffer.Application ) :
 
 		self.root()["scripts"].addChild( scriptNode )
 
+		if not args["worker"].value :
+			return self.__execute(
+				scriptNode, args["nodes"], self.parameters()["frames"].getFrameListValue().asList(), args["context"]
+			)
+
+		for line in sys.stdin :
+			request = json.loads( line )
+			result = self.__execute(
+				scriptNode, request["nodes"], IECore.FrameList.parse( request["frames"] ).asList(), request["context"]
+			)
+			# Nodes reading files hash on the file name rather than the contents,
+			# so cached results could be stale if a subsequent batch rewrites a
+			# file we've read. Clear the caches, as if each batch had a process
+			# of its own.
+			Gaffer.ValuePlug.clearCache()
+			Gaffer.ValuePlug.clearHashCache()
+			# The leading newline ensures the result starts on a line of its
+			# own, even if the task output didn't end with one.
+			sys.stdout.write( f"\n{_workerResultPrefix}{result}\n" )
+			sys.stdout.flush()
+
+		return 0
+
+	def __execute( self, scriptNode, nodeNames, frames, contextArgs ) :
+
 		nodes = []
-		if len( args["nodes"] ) :
-			for nodeName in args["nodes"] :
+		if len( nodeNames ) :
+			for nodeName in nodeNames :
 				node = scriptNode.descendant( nodeName )
 				if node is None :
 					IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Node \"%s\" does not exist" % nodeName )
@@ -152,16 +202,15 @@ class execute( Gaffer.Application ) :
 				IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Script has no executable nodes" )
 				return 1
 
-		if len(args["context"]) % 2 :
+		if len( contextArgs ) % 2 :
 			IECore.msg( IECore.Msg.Level.Error, "gaffer execute", "Context parameter must have matching entry/value pairs" )
 			return 1
 
 		context = Gaffer.Context( scriptNode.context() )
-		for i in range( 0, len(args["context"]), 2 ) :
-			entry = args["context"][i].lstrip( "-" )
-			context[entry] = eval( args["context"][i+1] )
+		for i in range( 0, len( contextArgs ), 2 ) :
+			entry = contextArgs[i].lstrip( "-" )
+			context[entry] = eval( contextArgs[i+1] )
 
-		frames = self.parameters()["frames"].getFrameListValue().asList()
 		if not frames :
 			frames = [ scriptNode.context().getFrame() ]
 
@@ -171,7 +220,11 @@ class execute( Gaffer.Application ) :
 
 		with context :
 			for node in nodes :
-				node.errorSignal().connect( Gaffer.WeakMethod( self.__error ), scoped = False )
+				if node not in self.__connectedNodes :
+					# Workers may execute the same node many times, so we
+					# only connect once.
+					node.errorSignal().connect( Gaffer.WeakMethod( self.__error ), scoped = False )
+					self.__connectedNodes.add( node )
 				try :
 					node["task"].executeSequence( frames )
 				except Exception as exception :
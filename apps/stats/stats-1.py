@@ -76,6 +76,12 @@ class stats( Gaffer.Application ) :
 			gaffer stats fileName.gfr -scene NameOfNode -performanceMonitor
 			```
 
+			To measure the performance of translating a scene for rendering :
+
+			```
+			gaffer stats fileName.gfr -scene NameOfNode -renderTranslation
+			```
+
 			To run an image processing node using the performance monitor :
 
 			```
@@ -184,6 +190,25 @@ class stats( Gaffer.Application ) :
 					defaultValue = False,
 				),
 
+				IECore.BoolParameter(
+					name = "objectMemory",
+					description = "Measures the memory used by the objects in the scene, "
+						"distinguishing between the total and the amount that is unique "
+						"once data shared between objects is accounted for. Measured on "
+						"the last frame, after scene generation.",
+					defaultValue = False,
+				),
+
+				IECore.BoolParameter(
+					name = "renderTranslation",
+					description = "Measures the performance of translating the scene for "
+						"rendering, by outputting it to a renderer which captures only hashes "
+						"of the objects and attributes it receives. This isolates the cost of "
+						"scene generation and translation from that of any production renderer. "
+						"If the scene is a Render node, its input scene is used.",
+					defaultValue = False,
+				),
+
 				IECore.StringParameter(
 					name = "task",
 					description = "The name of a TaskNode or TaskPlug to dispatch.",
@@ -362,6 +387,9 @@ class stats( Gaffer.Application ) :
 
 			self.__writeScene( script, args )
 
+			if args["renderTranslation"].value :
+				self.__writeRenderTranslation( script, args )
+
 		if args["image"].value :
 
 			self.__writeImage( script, args )
@@ -571,9 +599,81 @@ class stats( Gaffer.Application ) :
 		self.__timers["Scene generation"] = sceneTimer
 		self.__memory["Scene generation"] = _Memory.maxRSS() - memory
 
+		if args["objectMemory"].value and not isinstance( scene, GafferDispatch.TaskNode.TaskPlug ) :
+			with self.__context( script, args ) as context :
+				context.setFrame( frames[-1] )
+				usage = GafferScene.SceneAlgo.objectMemoryUsage( scene, root = args["location"].value or "/" )
+			self.__memory["Objects"] = usage.numObjects
+			self.__memory["Object memory (total)"] = _Memory( usage.totalBytes )
+			self.__memory["Object memory (unique)"] = _Memory( usage.uniqueBytes )
+			self.__memory["Object memory (shared)"] = _Memory( usage.totalBytes - usage.uniqueBytes )
+
 		## \todo Calculate and write scene stats
 		#  - Locations
-		#  - Unique objects, attributes etc
+		#  - Unique attributes etc
+
+	def __writeRenderTranslation( self, script, args ) :
+
+		import GafferScene
+
+		scene = script.descendant( args["scene"].value )
+		if isinstance( scene, GafferScene.Render ) :
+			scene = scene["in"]
+		elif isinstance( scene, Gaffer.Node ) :
+			scene = next( GafferScene.ScenePlug.RecursiveOutputRange( scene ), None )
+
+		if not isinstance( scene, GafferScene.ScenePlug ) :
+			IECore.msg( IECore.Msg.Level.Error, "stats", "Scene \"%s\" does not exist" % args["scene"].value )
+			return
+
+		frames = self.__frames( script, args )
+		statistics = []
+
+		def translateScene() :
+
+			del statistics[:]
+			with self.__context( script, args ) as context :
+				for frame in frames :
+					context.setFrame( frame )
+					renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+					renderer.option( "cr:hashOnly", IECore.BoolData( True ) )
+					controller = GafferScene.RenderController( scene, context, renderer )
+					controller.setMinimumExpansionDepth( 1024 )
+					controller.update()
+					statistics.append( renderer.statistics() )
+					del controller, renderer
+
+		if args["preCache"].value :
+			translateScene()
+
+		memory = _Memory.maxRSS()
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+			with _Timer() as translationTimer :
+				translateScene()
+
+		self.__timers["Render translation"] = translationTimer
+		self.__memory["Render translation"] = _Memory.maxRSS() - memory
+
+		numObjects = sum( s.objects for s in statistics )
+		numLights = sum( s.lights for s in statistics )
+		numCameras = sum( s.cameras for s in statistics )
+		numLightFilters = sum( s.lightFilters for s in statistics )
+		numAttributes = sum( s.attributes for s in statistics )
+		numLocations = numObjects + numLights + numCameras + numLightFilters
+
+		items = [
+			( "Objects", numObjects ),
+			( "Lights", numLights ),
+			( "Light filters", numLightFilters ),
+			( "Cameras", numCameras ),
+			( "Attributes", numAttributes ),
+			( "", "" ),
+			( "Locations per second", "%.1f" % ( numLocations / max( translationTimer.wallTime(), 1e-6 ) ) ),
+		]
+
+		self.__output.write( "Render translation :\n\n" )
+		self.__writeItems( items )
+		self.__output.write( "\n" )
 
 	def __writeImage( self, script, args ) :
 
@@ -731,6 +831,10 @@ class _Timer( object ) :
 		self.__time = time.time() - self.__time
 		self.__cpuTime = time.process_time() - self.__cpuTime
 
+	def wallTime( self ) :
+
+		return self.__time
+
 	def __str__( self ) :
 
 		return "%.3fs (wall), %.3fs (CPU)" % ( self.__time, self.__cpuTime )
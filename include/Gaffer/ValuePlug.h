@@ -158,6 +158,10 @@ class GAFFER_API ValuePlug : public Plug
 		static size_t cacheMemoryUsage();
 		/// Clears the cache.
 		static void clearCache();
+		/// Signal emitted by `clearCache()`. This allows auxiliary caches of
+		/// data derived from computed values to be cleared at the same time.
+		using CacheClearedSignal = Signals::Signal<void (), Signals::CatchingCombiner<void>>;
+		static CacheClearedSignal &cacheClearedSignal();
 		//@}
 
 		/// @name Hash cache management
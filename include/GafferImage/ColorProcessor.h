@@ -78,6 +78,11 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		virtual void hashColorProcessor( const Gaffer::Context *context, IECore::MurmurHash &h ) const = 0;
 		/// Must be implemented by derived classes to return a ColorProcessorFunction. An empty function
 		/// may be returned, in which case the node will pass through the input image data unchanged.
+		///
+		/// > Note : Chains of directly connected ColorProcessors are fused at compute time, so that
+		/// > the functions for the whole chain are applied in a single pass over each tile, without
+		/// > computing or caching the intermediate results. The function must therefore depend only
+		/// > on the values passed to it, and not on any other data from the input image.
 		virtual ColorProcessorFunction colorProcessor( const Gaffer::Context *context ) const = 0;
 
 	private :
@@ -94,6 +99,12 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		Gaffer::ObjectPlug *colorDataPlug();
 		const Gaffer::ObjectPlug *colorDataPlug() const;
 
+		// Walks upstream from `inPlug()` through any directly connected ColorProcessors
+		// which can be fused with this one, appending their functions to `processors`
+		// in downstream to upstream order. Returns the image that the first function
+		// in the fused chain should be applied to. Must be called in a global scope.
+		const ImagePlug *fusedInput( const std::vector<std::string> &channelNames, const std::string &layerName, bool unpremult, std::vector<ColorProcessorFunction> &processors ) const;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -159,14 +159,21 @@ void parallelProcessTiles(
 );
 
 // Process all tiles in parallel using TileFunctor, passing the
-// results in series to GatherFunctor.
+// results in series to GatherFunctor. At most `maxPendingTiles` results
+// are held in memory at once, waiting to be gathered. When an ordered
+// gather is waiting on a slow tile, computation of further tiles is paused
+// until the gather catches up, so memory use is bounded regardless of the
+// size of the image. Passing 0 uses one tile per hardware thread, which
+// is suitable for most purposes; larger values allow more work to proceed
+// past a slow tile, at the expense of memory.
 template <class TileFunctor, class GatherFunctor>
 void parallelGatherTiles(
 	const ImagePlug *image,
 	const TileFunctor &tileFunctor, // Signature : T tileFunctor( const ImagePlug *imagePlug, const V2i &tileOrigin )
 	GatherFunctor &&gatherFunctor, // Signature : void gatherFunctor( const ImagePlug *imagePlug, const V2i &tileOrigin, T &tileFunctorResult )
 	const Imath::Box2i &window = Imath::Box2i(), // Uses dataWindow if not specified ( requires a valid view in the context )
-	TileOrder tileOrder = Unordered
+	TileOrder tileOrder = Unordered,
+	size_t maxPendingTiles = 0
 );
 
 // Process all tiles in parallel using TileFunctor, passing the
@@ -178,7 +185,8 @@ void parallelGatherTiles(
 	const TileFunctor &tileFunctor, // Signature : T tileFunctor( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin )
 	GatherFunctor &&gatherFunctor, // Signature : void gatherFunctor( const ImagePlug *imagePlug, const string &channelName, const V2i &tileOrigin, T &tileFunctorResult )
 	const Imath::Box2i &window = Imath::Box2i(), // Uses dataWindow if not specified ( requires a valid view in the context )
-	TileOrder tileOrder = Unordered
+	TileOrder tileOrder = Unordered,
+	size_t maxPendingTiles = 0
 );
 
 /// Whole view operations
@@ -332,7 +332,7 @@ void parallelProcessTiles( const ImagePlug *imagePlug, const std::vector<std::st
 }
 
 template <class TileFunctor, class GatherFunctor>
-void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder, size_t maxPendingTiles )
 {
 	Imath::Box2i processWindow = window;
 	if( processWindow == Imath::Box2i() )
@@ -351,8 +351,16 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFun
 	Detail::TileInputIterator tileIterator( processWindow, tileOrder );
 	const Gaffer::ThreadState &threadState = Gaffer::ThreadState::current();
 
+	// The pipeline's token limit bounds the number of tiles that have been
+	// started but not yet gathered. For ordered gathers, this is what prevents
+	// unbounded buffering of completed tiles behind a slow one.
+	if( !maxPendingTiles )
+	{
+		maxPendingTiles = tbb::task_scheduler_init::default_num_threads();
+	}
+
 	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
-	parallel_pipeline( tbb::task_scheduler_init::default_num_threads(),
+	parallel_pipeline( maxPendingTiles,
 
 		tbb::make_filter<void, Imath::V2i>(
 			tbb::filter::serial,
@@ -397,7 +405,7 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const TileFunctor &tileFun
 }
 
 template <class TileFunctor, class GatherFunctor>
-void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder )
+void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::string> &channelNames, const TileFunctor &tileFunctor, GatherFunctor &&gatherFunctor, const Imath::Box2i &window, TileOrder tileOrder, size_t maxPendingTiles )
 {
 	using TileFunctorResult = std::invoke_result_t<TileFunctor, const ImagePlug *, const std::string &, const Imath::V2i &>;
 	using WholeTileResult = std::vector<TileFunctorResult>;
@@ -430,7 +438,7 @@ void parallelGatherTiles( const ImagePlug *imagePlug, const std::vector<std::str
 		}
 	};
 
-	parallelGatherTiles( imagePlug, f, g, window, tileOrder );
+	parallelGatherTiles( imagePlug, f, g, window, tileOrder, maxPendingTiles );
 }
 
 } // namespace ImageAlgo
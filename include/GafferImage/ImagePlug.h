@@ -256,6 +256,22 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
 
+		/// Describes the distribution of samples within a deep tile, allowing
+		/// deep processing to take a fast path for the common cases of tiles
+		/// containing no samples at all, or exactly one sample per pixel.
+		enum class TileSampleLayout
+		{
+			Empty,
+			Flat,
+			General
+		};
+
+		/// Classifies `sampleOffsets`. This is constant time for the shared
+		/// `emptyTileSampleOffsets()` and `flatTileSampleOffsets()`, which
+		/// ImageNode substitutes for any equivalent offsets it computes, and a
+		/// single pass over the offsets otherwise.
+		static TileSampleLayout tileSampleLayout( const IECore::IntVectorData *sampleOffsets );
+
 		static constexpr int tileSize() { return 1 << tileSizeLog2(); };
 		static constexpr int tilePixels() { return tileSize() * tileSize(); };
 
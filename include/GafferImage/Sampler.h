@@ -122,6 +122,13 @@ class GAFFERIMAGE_API Sampler
 		/// Convenience function to append into an
 		/// empty hash object and return it.
 		IECore::MurmurHash hash() const;
+		/// As above, but only hashing the tiles needed to service
+		/// samples from the specified tile-sized regions of the sample
+		/// window. This is much cheaper than hashing the whole sample
+		/// window when the caller knows that its samples are sparsely
+		/// distributed within it. It is the caller's responsibility to
+		/// ensure that all subsequent samples fall within these regions.
+		void hash( IECore::MurmurHash &h, const std::vector<Imath::V2i> &regionTileOrigins ) const;
 
 	private :
 
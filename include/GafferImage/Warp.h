@@ -94,6 +94,13 @@ class GAFFERIMAGE_API Warp : public FlatImageProcessor
 			/// output pixel.
 			virtual Imath::V2f inputPixel( const Imath::V2f &outputPixel ) const = 0;
 
+			/// Computes `inputPixel()` for a horizontal run of `count` output
+			/// pixels starting at `outputPixel`, storing the results in `result`.
+			/// The default implementation calls `inputPixel()` for each pixel in
+			/// turn, but it may be reimplemented to avoid the overhead of a
+			/// virtual call per pixel.
+			virtual void inputPixels( const Imath::V2f &outputPixel, int count, Imath::V2f *result ) const;
+
 			/// May be returned by inputPixel() to indicate that there is no
 			/// suitable input position, and black should be output instead.
 			static const Imath::V2f black;
@@ -123,6 +130,10 @@ class GAFFERIMAGE_API Warp : public FlatImageProcessor
 		const Gaffer::CompoundObjectPlug *sampleRegionsPlug() const;
 
 		static float approximateDerivative( float upperPos, float center, float lower );
+		/// Fills `result` with the input positions for the row of `ImagePlug::tileSize()`
+		/// pixels starting at `rowOrigin`, using `Engine::black` for pixels outside the
+		/// data window.
+		static void inputPixelRow( const Engine *engine, const Imath::V2i &rowOrigin, const Imath::Box2i &dataWindow, Imath::V2f *result );
 
 		static size_t g_firstPlugIndex;
 };
@@ -77,6 +77,8 @@ class GAFFERSCENE_API MeshDistortion : public ObjectProcessor
 
 	private :
 
+		Gaffer::ValuePlug::CachePolicy processedObjectComputeCachePolicy() const final;
+
 		static size_t g_firstPlugIndex;
 
 };
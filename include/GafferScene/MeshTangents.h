@@ -101,6 +101,8 @@ class GAFFERSCENE_API MeshTangents : public ObjectProcessor
 
 	private :
 
+		Gaffer::ValuePlug::CachePolicy processedObjectComputeCachePolicy() const final;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -113,6 +113,24 @@ class GAFFERSCENE_API PrimitiveSampler : public Deformer
 		/// `index` values in the interval `[ 0, destinationPrimitive->variableSize( interpolation ) )`.
 		virtual SamplingFunction computeSamplingFunction( const IECoreScene::Primitive *destinationPrimitive, IECoreScene::PrimitiveVariable::Interpolation &interpolation ) const = 0;
 
+		/// Sampling order
+		/// ==============
+		///
+		/// Queries are made in batches, and making neighbouring queries close in space
+		/// improves the coherence of accesses to the evaluator's acceleration structure.
+		/// This can give significant performance improvements for large source primitives.
+
+		/// May be implemented to fill `order` with a permutation of the indices passed
+		/// to the `SamplingFunction`, specifying the order in which queries should be
+		/// made. Only called when there are enough queries to make it worthwhile. The
+		/// default implementation leaves `order` empty, meaning that queries are made
+		/// in index order. Implementations should only use plugs already hashed by
+		/// `hashSamplingFunction()`.
+		virtual void computeSamplingOrder( const IECoreScene::Primitive *destinationPrimitive, IECoreScene::PrimitiveVariable::Interpolation interpolation, std::vector<size_t> &order ) const;
+		/// Utility for implementing `computeSamplingOrder()`. Fills `order` so that
+		/// the indices of nearby positions are adjacent.
+		static void spatialOrder( const std::vector<Imath::V3f> &positions, std::vector<size_t> &order );
+
 	private :
 
 		bool affectsProcessedObject( const Gaffer::Plug *input ) const final;
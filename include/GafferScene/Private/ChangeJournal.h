@@ -0,0 +1,116 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/Export.h"
+
+#include "Gaffer/Node.h"
+#include "Gaffer/Signals.h"
+#include "Gaffer/ValuePlug.h"
+
+#include "IECore/PathMatcher.h"
+
+#include "boost/noncopyable.hpp"
+
+#include <optional>
+#include <unordered_map>
+
+namespace GafferScene
+{
+
+namespace Private
+{
+
+/// Determines which locations are affected by edits to the node graph,
+/// so that clients such as the RenderController can update just those
+/// locations instead of revisiting the whole scene. Edits are tracked by
+/// connecting to `plugDirtiedSignal()` on the processors upstream of the
+/// client's scene. Only a handful of processors are understood : those
+/// whose edits are confined to the locations matched by a PathFilter with
+/// static paths, and those which are known to pass through changes to
+/// their input without moving them to other locations. Any other edits
+/// are reported as affecting unknown paths.
+class GAFFERSCENE_API ChangeJournal : boost::noncopyable
+{
+
+	public :
+
+		ChangeJournal();
+		~ChangeJournal();
+
+		/// Returns the paths affected by the dirtying of `plug`, which must
+		/// be a child of a ScenePlug. Returns `std::nullopt` if the paths
+		/// can't be determined, in which case the client must assume that
+		/// all locations are affected. Must be called from `plugDirtiedSignal()`,
+		/// for every dirtying of `plug`.
+		///
+		/// > Note : Processors are only tracked once they have been visited
+		/// > by a call to `affectedPaths()`, so the first call for any given
+		/// > upstream graph always returns `std::nullopt`.
+		std::optional<IECore::PathMatcher> affectedPaths( const Gaffer::ValuePlug *plug );
+
+		/// Discards the edits recorded so far. Should be called by the client
+		/// once it has dealt with all the paths returned by `affectedPaths()`.
+		void clear();
+
+	private :
+
+		struct ProcessorEntry
+		{
+			Gaffer::ConstNodePtr node;
+			Gaffer::Signals::ScopedConnection plugDirtiedConnection;
+			IECore::PathMatcher paths;
+			bool unknownPaths = false;
+		};
+
+		struct SourceEntry
+		{
+			Gaffer::ConstValuePlugPtr plug;
+			uint64_t dirtyCount = 0;
+		};
+
+		void plugDirtied( const Gaffer::Plug *plug, ProcessorEntry &entry );
+		bool sourceUnchanged( const Gaffer::ValuePlug *plug );
+
+		std::unordered_map<const Gaffer::Node *, ProcessorEntry> m_processors;
+		std::unordered_map<const Gaffer::ValuePlug *, SourceEntry> m_sources;
+
+};
+
+} // namespace Private
+
+} // namespace GafferScene
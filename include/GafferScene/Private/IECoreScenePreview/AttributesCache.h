@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/Private/IECoreScenePreview/Renderer.h"
+
+#include "IECoreScene/ShaderNetwork.h"
+
+#include "tbb/concurrent_hash_map.h"
+
+#include <atomic>
+
+namespace IECoreScenePreview
+{
+
+/// Renderer-agnostic cache of AttributesInterfaces, shared between all the
+/// locations output to a renderer. Attributes are interned by hash, so that
+/// identical attributes are only converted by the renderer once. Shader
+/// networks are also interned, so that renderers receive the same
+/// ShaderNetwork instance for every attribute set using a particular shader.
+class GAFFERSCENE_API AttributesCache : public IECore::RefCounted
+{
+
+	public :
+
+		IE_CORE_DECLAREMEMBERPTR( AttributesCache )
+
+		/// The renderer must outlive the cache.
+		AttributesCache( Renderer *renderer );
+		~AttributesCache() override;
+
+		/// Returns an AttributesInterface for `attributes`, reusing a
+		/// previously created one if the attributes are identical. May be
+		/// called concurrently.
+		Renderer::AttributesInterfacePtr get( const IECore::CompoundObject *attributes );
+
+		/// Removes AttributesInterfaces and shaders which are no longer
+		/// referenced outside the cache. Must not be called concurrently
+		/// with `get()`.
+		void clearUnused();
+
+		struct Statistics
+		{
+			size_t attributesHits = 0;
+			size_t attributesMisses = 0;
+			size_t shaderHits = 0;
+			size_t shaderMisses = 0;
+		};
+
+		Statistics statistics() const;
+
+	private :
+
+		IECore::ConstCompoundObjectPtr internShaders( const IECore::CompoundObject *attributes );
+
+		Renderer *m_renderer;
+
+		using AttributesMap = tbb::concurrent_hash_map<IECore::MurmurHash, Renderer::AttributesInterfacePtr>;
+		AttributesMap m_attributes;
+
+		using ShaderMap = tbb::concurrent_hash_map<IECore::MurmurHash, IECoreScene::ConstShaderNetworkPtr>;
+		ShaderMap m_shaders;
+
+		std::atomic_size_t m_attributesHits;
+		std::atomic_size_t m_attributesMisses;
+		std::atomic_size_t m_shaderHits;
+		std::atomic_size_t m_shaderMisses;
+
+};
+
+IE_CORE_DECLAREPTR( AttributesCache )
+
+} // namespace IECoreScenePreview
@@ -53,6 +53,11 @@ namespace IECoreScenePreview
 /// If the Bool `cr:unrenderable` attribute is set to true at a location, then
 /// calls to object, light, lightFilter, camera, etc... for that location will
 /// return nullptr rather than a valid ObjectInterface.
+///
+/// If the Bool `cr:hashOnly` option is set to true, then objects and attributes
+/// are captured as hashes rather than as copies. This keeps memory usage and
+/// capture overhead to a minimum, making the renderer suitable for benchmarking
+/// the performance of scene translation in isolation.
 class GAFFERSCENE_API CapturingRenderer : public Renderer
 {
 
@@ -77,11 +82,13 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 
 				IE_CORE_DECLAREMEMBERPTR( CapturedAttributes );
 
+				/// Returns null if the `cr:hashOnly` option was set.
 				const IECore::CompoundObject *attributes() const;
+				IECore::MurmurHash hash() const;
 
 			private :
 
-				CapturedAttributes( const IECore::ConstCompoundObjectPtr &attributes );
+				CapturedAttributes( const IECore::ConstCompoundObjectPtr &attributes, bool hashOnly );
 
 				int uneditableAttributeValue() const;
 				bool unrenderableAttributeValue() const;
@@ -89,6 +96,9 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 				friend class CapturingRenderer;
 
 				IECore::ConstCompoundObjectPtr m_attributes;
+				IECore::MurmurHash m_hash;
+				int m_uneditableAttributeValue;
+				bool m_unrenderableAttributeValue;
 
 		};
 
@@ -108,8 +118,12 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 
 				const std::string &capturedName() const;
 
+				/// Empty if the `cr:hashOnly` option was set.
 				const std::vector<IECore::ConstObjectPtr> &capturedSamples() const;
 				const std::vector<float> &capturedSampleTimes() const;
+				/// Hash of the captured samples and sample times, available
+				/// regardless of the `cr:hashOnly` option.
+				IECore::MurmurHash capturedSamplesHash() const;
 
 				const std::vector<Imath::M44f> &capturedTransforms() const;
 				const std::vector<float> &capturedTransformTimes() const;
@@ -134,14 +148,15 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 
 			private :
 
-				CapturedObject( CapturingRenderer *renderer, const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times );
+				CapturedObject( CapturingRenderer *renderer, const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, bool hashOnly );
 
 				friend class CapturingRenderer;
 
 				CapturingRenderer *m_renderer;
 				const std::string m_name;
-				const std::vector<IECore::ConstObjectPtr> m_capturedSamples;
+				std::vector<IECore::ConstObjectPtr> m_capturedSamples;
 				const std::vector<float> m_capturedSampleTimes;
+				IECore::MurmurHash m_capturedSamplesHash;
 				std::vector<Imath::M44f> m_capturedTransforms;
 				std::vector<float> m_capturedTransformTimes;
 				ConstCapturedAttributesPtr m_capturedAttributes;
@@ -155,6 +170,24 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 
 		std::vector<std::string> capturedObjectNames() const;
 		const CapturedObject *capturedObject( const std::string &name ) const;
+		/// Returns the number of calls made to `instances()`.
+		size_t numInstanceBatches() const;
+
+		/// Counts of the calls made to the renderer, for use in
+		/// benchmarking and testing.
+		struct Statistics
+		{
+			size_t attributes = 0;
+			size_t cameras = 0;
+			size_t lights = 0;
+			size_t lightFilters = 0;
+			size_t objects = 0;
+			size_t transformEdits = 0;
+			size_t attributeEdits = 0;
+			size_t linkEdits = 0;
+		};
+
+		Statistics statistics() const;
 
 		/// Renderer interface
 		/// ==================
@@ -169,19 +202,37 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 		ObjectInterfacePtr lightFilter( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		ObjectInterfacePtr object( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) override;
+		void instances( const std::vector<std::string> &names, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const std::vector<Imath::M44f> &transforms, const std::vector<float> &transformTimes, const AttributesInterface *attributes ) override;
 		void render() override;
 		void pause() override;
 
 	private :
 
 		void checkPaused() const;
+		ObjectInterfacePtr captureObject( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes );
 
 		IECore::MessageHandlerPtr m_messageHandler;
 
 		RenderType m_renderType;
 		std::atomic_bool m_rendering;
+		bool m_hashOnly;
 		using ObjectMap = tbb::concurrent_hash_map<std::string, CapturedObject *>;
 		ObjectMap m_capturedObjects;
+		std::atomic_size_t m_numInstanceBatches;
+
+		struct AtomicStatistics
+		{
+			std::atomic_size_t attributes = 0;
+			std::atomic_size_t cameras = 0;
+			std::atomic_size_t lights = 0;
+			std::atomic_size_t lightFilters = 0;
+			std::atomic_size_t objects = 0;
+			std::atomic_size_t transformEdits = 0;
+			std::atomic_size_t attributeEdits = 0;
+			std::atomic_size_t linkEdits = 0;
+		};
+
+		AtomicStatistics m_statistics;
 
 		static Renderer::TypeDescription<CapturingRenderer> g_typeDescription;
 
@@ -290,6 +290,16 @@ class GAFFERSCENE_API Renderer : public IECore::RefCounted
 		/// As above, but specifying a deforming object.
 		virtual ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) = 0;
 
+		/// Adds many named instances of the same object in a single call. If `times` is
+		/// empty then `samples` must contain a single static object. `transforms` contains
+		/// `max( 1, transformTimes.size() )` consecutive samples for each instance, in the
+		/// same order as `names`. Instances can not be edited after creation, so this is
+		/// intended for use in Batch renders and when expanding procedurals, where it
+		/// allows renderers with native instancing to share a single prototype. A default
+		/// implementation that calls `object()` and `ObjectInterface::transform()` for each
+		/// instance is provided for renderers which don't support native instancing.
+		virtual void instances( const std::vector<std::string> &names, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const std::vector<Imath::M44f> &transforms, const std::vector<float> &transformTimes, const AttributesInterface *attributes );
+
 		/// Performs the render - should be called after the
 		/// entire scene has been specified using the methods
 		/// above. Batch and SceneDescripton renders will have
@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/Export.h"
+#include "GafferScene/ScenePlug.h"
+
+#include "IECore/PathMatcherData.h"
+
+#include <functional>
+
+namespace GafferScene
+{
+
+namespace Private
+{
+
+namespace IncrementalSet
+{
+
+/// Returns true if `path` from the input set should be kept in the output set.
+using KeepFunction = std::function<bool ( const ScenePlug::ScenePath &path )>;
+/// Computes the output set from scratch.
+using ComputeFunction = std::function<IECore::ConstPathMatcherDataPtr ( const IECore::PathMatcherData *input )>;
+
+/// Returns the set containing the paths of `input` for which `keep()` returns
+/// true, as computed by `compute()`. The result of the last call with the same
+/// `key` is remembered. If it is available and `input` differs only a little
+/// from that call's input, the previous result is patched instead of calling
+/// `compute()`. Paths removed from the input are removed from the result, and
+/// `keep()` is called only for the added paths. This is typical of animated
+/// scenes, where set hashes change from frame to frame but few paths change
+/// membership.
+///
+/// `key` must identify everything other than `input` that the result depends
+/// on. So `keep()` must give the same result for a given path for all calls
+/// with the same key. The key should be derived from hashes rather than
+/// addresses, which may be reused. Remembered results are discarded by
+/// `ValuePlug::clearCache()`.
+GAFFERSCENE_API IECore::ConstPathMatcherDataPtr filter(
+	const IECore::MurmurHash &key, const IECore::ConstPathMatcherDataPtr &input,
+	const KeepFunction &keep, const ComputeFunction &compute
+);
+
+} // namespace IncrementalSet
+
+} // namespace Private
+
+} // namespace GafferScene
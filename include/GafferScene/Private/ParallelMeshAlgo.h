@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/Export.h"
+
+#include "IECoreScene/MeshPrimitive.h"
+#include "IECoreScene/PointsPrimitive.h"
+
+#include "IECore/Canceller.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace GafferScene
+{
+
+namespace Private
+{
+
+namespace ParallelMeshAlgo
+{
+
+/// A function which computes primitive variables for a mesh, such as one of the
+/// `IECoreScene::MeshAlgo::calculate*()` functions.
+using MeshFunction = std::function<std::vector<IECoreScene::PrimitiveVariable> ( const IECoreScene::MeshPrimitive *mesh, const IECore::Canceller *canceller )>;
+
+/// Returns the result of `function( mesh )`, computed in parallel on large meshes.
+/// The mesh is split into chunks of faces, and each chunk is extended with the
+/// faces sharing a vertex with it. `function` is then called on a submesh per
+/// chunk, and the elements each chunk owns are copied into the final result.
+///
+/// This is only valid if `function` is local. The value it computes for a face,
+/// face-vertex or vertex may depend only on the faces sharing a vertex with that
+/// element, visited in face order. This holds for normals, tangents and
+/// distortion. Given that, the result is identical to calling `function` on the
+/// whole mesh, whatever the chunking or thread scheduling. `variables` names the
+/// primitive variables that `function` reads, and only these are copied to the
+/// submeshes. If the result can't be assembled from chunks (for example because
+/// it is indexed or has Constant interpolation), `function( mesh )` is called
+/// directly instead.
+GAFFERSCENE_API std::vector<IECoreScene::PrimitiveVariable> evaluate(
+	const IECoreScene::MeshPrimitive *mesh, const std::vector<std::string> &variables,
+	const MeshFunction &function, const IECore::Canceller *canceller = nullptr
+);
+
+/// A function which generates points over the faces of a mesh, such as
+/// `IECoreScene::MeshAlgo::distributePoints()`.
+using PointsFunction = std::function<IECoreScene::PointsPrimitivePtr ( const IECoreScene::MeshPrimitive *mesh, const IECore::Canceller *canceller )>;
+
+/// Returns the result of `function( mesh )`, computed in parallel. The faces are
+/// split into contiguous chunks, and `function` is called on a submesh for each
+/// chunk. The resulting points are then concatenated in face order into
+/// preallocated arrays. This is only valid if the points `function` generates
+/// for a face depend only on that face. In that case the result is identical
+/// to calling `function` on the whole mesh, whatever the number of threads.
+/// If the chunk results can't be concatenated, `function( mesh )` is called
+/// directly instead.
+GAFFERSCENE_API IECoreScene::PointsPrimitivePtr generatePoints(
+	const IECoreScene::MeshPrimitive *mesh, const PointsFunction &function,
+	const IECore::Canceller *canceller = nullptr
+);
+
+} // namespace ParallelMeshAlgo
+
+} // namespace Private
+
+} // namespace GafferScene
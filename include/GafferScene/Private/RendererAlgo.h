@@ -38,6 +38,7 @@
 
 #include "GafferScene/ScenePlug.h"
 
+#include "GafferScene/Private/IECoreScenePreview/AttributesCache.h"
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
 
 #include "IECoreScene/VisibleRenderable.h"
@@ -48,8 +49,7 @@
 #include "boost/container/flat_map.hpp"
 
 #include "tbb/concurrent_hash_map.h"
-#include "tbb/spin_mutex.h"
-
+#include <atomic>
 #include <functional>
 
 namespace GafferScene
@@ -222,7 +222,8 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 		/// Returns true if a call to `outputLightFilterLinks()` is necessary.
 		bool lightFilterLinksDirty() const;
 		/// Must be called once all necessary calls to `outputLightLinks()`
-		/// and `outputLightFilterLinks()` have been made.
+		/// and `outputLightFilterLinks()` have been made. Discards the light
+		/// links for expressions which are no longer used by any object.
 		void clean();
 
 	private :
@@ -230,9 +231,10 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 		void addFilterLink( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const std::string &filteredLightsExpression );
 		void removeFilterLink( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const std::string &filteredLightsExpression );
 		std::string filteredLightsExpression( const IECore::CompoundObject *attributes ) const;
-		IECoreScenePreview::Renderer::ConstObjectSetPtr linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene ) const;
+		// Returns the lights linked by `linkedLightsExpression`, and appends
+		// to `linkHash` such that it only changes when the result does.
+		IECoreScenePreview::Renderer::ConstObjectSetPtr linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene, IECore::MurmurHash &linkHash ) const;
 		void outputLightFilterLinks( const std::string &lightName, IECoreScenePreview::Renderer::ObjectInterface *light ) const;
-		void clearLightLinks();
 
 		/// Storage for lights. This maps from the light name to the light itself.
 		using LightMap = tbb::concurrent_hash_map<std::string, IECoreScenePreview::Renderer::ObjectInterfacePtr>;
@@ -246,11 +248,29 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 		/// ===========================
 		///
 		/// This maps from `linkedLights` expressions to ObjectSets containing
-		/// the relevant lights.
+		/// the relevant lights. The ObjectSets are shared by all objects using
+		/// the same expression. Rather than being discarded when lights or sets
+		/// change, they are revalidated lazily the next time they are needed,
+		/// and only replaced if their contents have changed. Entries which
+		/// weren't revalidated by a full relinking are removed by `clean()`.
 
-		using LightLinkMap = tbb::concurrent_hash_map<std::string, IECoreScenePreview::Renderer::ObjectSetPtr>;
+		struct LightLink
+		{
+			IECoreScenePreview::Renderer::ConstObjectSetPtr lights;
+			// Incremented each time `lights` is replaced.
+			uint64_t version = 0;
+			IECore::MurmurHash setExpressionHash;
+			uint64_t lightsGeneration = 0;
+			uint64_t setsGeneration = 0;
+		};
+
+		using LightLinkMap = tbb::concurrent_hash_map<std::string, LightLink>;
 		mutable LightLinkMap m_lightLinks;
-		tbb::spin_mutex m_lightLinksClearMutex;
+
+		/// Incremented by `addLight()/removeLight()` and `setsDirtied()`
+		/// respectively, to invalidate the LightLinks above.
+		std::atomic<uint64_t> m_lightsGeneration;
+		uint64_t m_setsGeneration;
 
 		/// Storage for links between lights and light filters
 		/// ==================================================
@@ -279,10 +299,14 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 
 };
 
-GAFFERSCENE_API void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer );
-GAFFERSCENE_API void outputLightFilters( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
-GAFFERSCENE_API void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
-GAFFERSCENE_API void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+/// The `attributesCache` should be shared between all the output functions
+/// called for a render, so that identical attributes are shared between
+/// cameras, lights, light filters and objects. If it is null, a temporary
+/// cache is used for the call alone.
+GAFFERSCENE_API void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache = nullptr );
+GAFFERSCENE_API void outputLightFilters( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache = nullptr );
+GAFFERSCENE_API void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache = nullptr );
+GAFFERSCENE_API void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root = ScenePlug::ScenePath(), IECoreScenePreview::AttributesCache *attributesCache = nullptr );
 
 } // namespace RendererAlgo
 
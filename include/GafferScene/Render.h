@@ -44,11 +44,20 @@
 #include "Gaffer/NumericPlug.h"
 #include "Gaffer/StringPlug.h"
 
+#include <memory>
+
 namespace GafferScene
 {
 
 IE_CORE_FORWARDDECLARE( ScenePlug )
 
+namespace Private::RendererAlgo
+{
+
+class RenderSets;
+
+} // namespace Private::RendererAlgo
+
 class GAFFERSCENE_API Render : public GafferDispatch::TaskNode
 {
 
@@ -96,7 +105,10 @@ class GAFFERSCENE_API Render : public GafferDispatch::TaskNode
 
 	private :
 
-		void executeInternal( bool flushCaches ) const;
+		// If `renderSets` is non-null, it is updated and reused rather than
+		// being computed from scratch. This allows `executeSequence()` to
+		// avoid repeating work for sets that don't change between frames.
+		void executeInternal( bool flushCaches, std::unique_ptr<Private::RendererAlgo::RenderSets> *renderSets = nullptr ) const;
 
 		ScenePlug *adaptedInPlug();
 		const ScenePlug *adaptedInPlug() const;
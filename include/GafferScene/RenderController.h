@@ -41,6 +41,7 @@
 
 #include "Gaffer/Signals.h"
 
+#include "GafferScene/Private/IECoreScenePreview/AttributesCache.h"
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
 #include "GafferScene/Private/RendererAlgo.h"
 
@@ -54,6 +55,13 @@ namespace GafferScene
 
 IE_CORE_FORWARDDECLARE( ScenePlug )
 
+namespace Private
+{
+
+class ChangeJournal;
+
+} // namespace Private
+
 /// Utility class used to make interactive updates to a Renderer.
 class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 {
@@ -131,6 +139,7 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 		void requestUpdate();
 		void dirtyGlobals( unsigned components );
 		void dirtySceneGraphs( unsigned components );
+		void dirtySceneGraphs( unsigned components, const IECore::PathMatcher &paths );
 
 		void updateInternal( const ProgressCallback &callback = ProgressCallback(), const IECore::PathMatcher *pathsToUpdate = nullptr, bool signalCompletion = true );
 		void updateDefaultCamera();
@@ -157,6 +166,12 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 		std::atomic<uint64_t> m_failedAttributeEdits;
 
 		std::vector<std::unique_ptr<SceneGraph> > m_sceneGraphs;
+		// Used to restrict updates to just the locations affected
+		// by edits, when these are known. When `m_dirtyPathsValid`
+		// is false, all locations must be visited.
+		std::unique_ptr<Private::ChangeJournal> m_changeJournal;
+		IECore::PathMatcher m_dirtyPaths;
+		bool m_dirtyPathsValid;
 		unsigned m_dirtyGlobalComponents;
 		unsigned m_changedGlobalComponents;
 		Private::RendererAlgo::RenderOptions m_renderOptions;
@@ -164,6 +179,9 @@ class GAFFERSCENE_API RenderController : public Gaffer::Signals::Trackable
 		std::unique_ptr<Private::RendererAlgo::LightLinks> m_lightLinks;
 		IECoreScenePreview::Renderer::ObjectInterfacePtr m_defaultCamera;
 		IECoreScenePreview::Renderer::AttributesInterfacePtr m_defaultAttributes;
+		// Shares AttributesInterfaces between all locations with
+		// identical attributes.
+		IECoreScenePreview::AttributesCachePtr m_attributesCache;
 
 		std::shared_ptr<Gaffer::BackgroundTask> m_backgroundTask;
 
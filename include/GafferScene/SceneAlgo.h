@@ -50,8 +50,16 @@
 IECORE_PUSH_DEFAULT_VISIBILITY
 #include "OpenEXR/OpenEXRConfig.h"
 #if OPENEXR_VERSION_MAJOR < 3
+#include "OpenEXR/ImathBoxAlgo.h"
+#include "OpenEXR/ImathFrustum.h"
+#include "OpenEXR/ImathFrustumTest.h"
+#include "OpenEXR/ImathLine.h"
 #include "OpenEXR/ImathVec.h"
 #else
+#include "Imath/ImathBoxAlgo.h"
+#include "Imath/ImathFrustum.h"
+#include "Imath/ImathFrustumTest.h"
+#include "Imath/ImathLine.h"
 #include "Imath/ImathVec.h"
 #endif
 IECORE_POP_DEFAULT_VISIBILITY
@@ -144,6 +152,31 @@ void filteredParallelTraverse( const ScenePlug *scene, const FilterPlug *filterP
 template <class ThreadableFunctor>
 void filteredParallelTraverse( const ScenePlug *scene, const IECore::PathMatcher &filter, ThreadableFunctor &f, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
 
+/// Culled traversal
+/// ================
+///
+/// These variants visit only the locations whose bounds intersect a volume,
+/// pruning whole subtrees as soon as a bound is found to lie outside it.
+/// Because bounds are checked before `childNames` is computed, the cost of
+/// traversal is proportional to the number of locations within the volume
+/// rather than the size of the scene.
+///
+/// `Volume` may be an `Imath::Box3f`, an `Imath::Line3f` (treated as a ray
+/// starting at `pos`) or an `Imath::Frustumf`. The volume is specified in
+/// the space defined by `worldToVolume` : for instance a frustum would be
+/// specified in camera space, and `worldToVolume` would be the inverse of
+/// the camera transform. Locations with empty bounds are never visited.
+
+/// As for `parallelProcessLocations()`, but only visiting locations that
+/// intersect `volume`.
+template <class Volume, class ThreadableFunctor>
+void culledParallelProcessLocations( const ScenePlug *scene, const Volume &volume, const Imath::M44f &worldToVolume, ThreadableFunctor &f, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+
+/// As for `parallelTraverse()`, but only visiting locations that intersect
+/// `volume`.
+template <class Volume, class ThreadableFunctor>
+void culledParallelTraverse( const ScenePlug *scene, const Volume &volume, const Imath::M44f &worldToVolume, ThreadableFunctor &f, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+
 /// Searching
 /// =========
 
@@ -158,6 +191,24 @@ IECore::PathMatcher findAll( const ScenePlug *scene, Predicate &&predicate, cons
 /// returns locations where the attribute has that value.
 GAFFERSCENE_API IECore::PathMatcher findAllWithAttribute( const ScenePlug *scene, IECore::InternedString name, const IECore::Object *value = nullptr, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
 
+/// Memory usage
+/// ============
+
+struct ObjectMemoryUsage
+{
+	/// The number of locations with an object.
+	size_t numObjects = 0;
+	/// The sum of `Object::memoryUsage()` for all objects. Data shared
+	/// between objects is counted once for each object.
+	size_t totalBytes = 0;
+	/// As above, but counting data shared between objects only once.
+	/// The difference from `totalBytes` is the memory saved by sharing.
+	size_t uniqueBytes = 0;
+};
+
+/// Returns the memory used by the objects at and below `root`.
+GAFFERSCENE_API ObjectMemoryUsage objectMemoryUsage( const ScenePlug *scene, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+
 /// Globals
 /// =======
 
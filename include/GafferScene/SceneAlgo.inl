@@ -142,6 +142,119 @@ struct PathMatcherFunctor
 
 };
 
+template<typename Volume>
+struct VolumeTest;
+
+template<>
+struct VolumeTest<Imath::Box3f>
+{
+
+	VolumeTest( const Imath::Box3f &box )
+		:	m_box( box )
+	{
+	}
+
+	bool operator()( const Imath::Box3f &bound ) const
+	{
+		return m_box.intersects( bound );
+	}
+
+	private :
+
+		const Imath::Box3f m_box;
+
+};
+
+template<>
+struct VolumeTest<Imath::Line3f>
+{
+
+	VolumeTest( const Imath::Line3f &ray )
+		:	m_ray( ray )
+	{
+	}
+
+	bool operator()( const Imath::Box3f &bound ) const
+	{
+		return Imath::intersects( bound, m_ray );
+	}
+
+	private :
+
+		const Imath::Line3f m_ray;
+
+};
+
+template<>
+struct VolumeTest<Imath::Frustumf>
+{
+
+	VolumeTest( const Imath::Frustumf &frustum )
+		:	m_frustumTest( frustum, Imath::M44f() )
+	{
+	}
+
+	bool operator()( const Imath::Box3f &bound ) const
+	{
+		return m_frustumTest.isVisible( bound );
+	}
+
+	private :
+
+		const Imath::FrustumTest<float> m_frustumTest;
+
+};
+
+// Wraps a functor so that it is only called for locations intersecting a
+// volume. Each child receives a copy of its parent's functor, from which it
+// inherits the accumulated transform to volume space.
+template<typename Volume, typename ThreadableFunctor>
+struct CullingFunctor
+{
+
+	CullingFunctor( const VolumeTest<Volume> &volumeTest, const Imath::M44f &parentToVolume, ThreadableFunctor &f )
+		:	m_volumeTest( volumeTest ), m_toVolume( parentToVolume ), m_f( f )
+	{
+	}
+
+	bool operator()( const GafferScene::ScenePlug *scene, const GafferScene::ScenePlug::ScenePath &path )
+	{
+		if( !path.empty() )
+		{
+			m_toVolume = scene->transformPlug()->getValue() * m_toVolume;
+		}
+
+		if( !m_volumeTest( Imath::transform( scene->boundPlug()->getValue(), m_toVolume ) ) )
+		{
+			return false;
+		}
+
+		return m_f( scene, path );
+	}
+
+	private :
+
+		const VolumeTest<Volume> &m_volumeTest;
+		Imath::M44f m_toVolume;
+		ThreadableFunctor m_f;
+
+};
+
+template<typename Volume, typename ThreadableFunctor>
+void culledParallelProcessLocationsInternal( const ScenePlug *scene, const Volume &volume, const Imath::M44f &worldToVolume, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
+{
+	Imath::M44f parentToVolume = worldToVolume;
+	if( root.size() > 1 )
+	{
+		const ScenePlug::ScenePath parentPath( root.begin(), root.end() - 1 );
+		parentToVolume = scene->fullTransform( parentPath ) * worldToVolume;
+	}
+
+	const VolumeTest<Volume> volumeTest( volume );
+	CullingFunctor<Volume, ThreadableFunctor> cullingFunctor( volumeTest, parentToVolume, f );
+	SceneAlgo::parallelProcessLocations( scene, cullingFunctor, root );
+}
+
 } // namespace Detail
 
 namespace SceneAlgo
@@ -180,6 +293,22 @@ void filteredParallelTraverse( const ScenePlug *scene, const IECore::PathMatcher
 	parallelTraverse( scene, ff, root );
 }
 
+template <class Volume, class ThreadableFunctor>
+void culledParallelProcessLocations( const ScenePlug *scene, const Volume &volume, const Imath::M44f &worldToVolume, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
+{
+	Detail::culledParallelProcessLocationsInternal( scene, volume, worldToVolume, f, root );
+}
+
+template <class Volume, class ThreadableFunctor>
+void culledParallelTraverse( const ScenePlug *scene, const Volume &volume, const Imath::M44f &worldToVolume, ThreadableFunctor &f, const ScenePlug::ScenePath &root )
+{
+	// As for `parallelTraverse()`, wrap the functor so that it isn't copied.
+	auto reference = [&f] ( const ScenePlug *scene, const ScenePlug::ScenePath &path ) {
+		return f( scene, path );
+	};
+	Detail::culledParallelProcessLocationsInternal( scene, volume, worldToVolume, reference, root );
+}
+
 template<typename Predicate>
 IECore::PathMatcher findAll( const ScenePlug *scene, Predicate &&predicate, const ScenePlug::ScenePath &root )
 {
@@ -77,8 +77,26 @@ class GAFFERSCENE_API SceneReader : public SceneNode
 		Gaffer::TransformPlug *transformPlug();
 		const Gaffer::TransformPlug *transformPlug() const;
 
+		/// When greater than zero, computing the child names for a location
+		/// schedules background reads of the bounds and transforms for this
+		/// many levels of descendants, so that they are available without
+		/// waiting on I/O when they are computed subsequently.
+		Gaffer::IntPlug *prefetchDepthPlug();
+		const Gaffer::IntPlug *prefetchDepthPlug() const;
+
+		/// Includes objects in the reads made by `prefetchDepthPlug()`.
+		Gaffer::BoolPlug *prefetchObjectsPlug();
+		const Gaffer::BoolPlug *prefetchObjectsPlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
+		/// Limits the memory used to hold data read by `prefetchDepthPlug()`
+		/// until it is computed, shared between all SceneReaders. The least
+		/// recently read data is discarded first if the limit is exceeded.
+		/// Prefetched data is also discarded by `ValuePlug::clearCache()`.
+		static void setPrefetchMemoryLimit( size_t bytes );
+		static size_t getPrefetchMemoryLimit();
+
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
 	protected :
@@ -130,8 +148,9 @@ class GAFFERSCENE_API SceneReader : public SceneNode
 		// Returns the SceneInterface for the current filename and specified
 		// path, using `m_lastScene` to accelerate the lookups. If `refreshCount`
 		// or `tags` are provided, they are filled from `refreshCountPlug()` and
-		// `tagsPlug()` respectively.
-		IECoreScene::ConstSceneInterfacePtr scene( const ScenePath &path, const Gaffer::Context *context, int *refreshCount = nullptr, std::string *tags = nullptr ) const;
+		// `tagsPlug()` respectively. If `fileName` is provided, it is filled
+		// with the value of `fileNamePlug()`.
+		IECoreScene::ConstSceneInterfacePtr scene( const ScenePath &path, const Gaffer::Context *context, int *refreshCount = nullptr, std::string *tags = nullptr, std::string *fileName = nullptr ) const;
 
 		static const double g_frameRate;
 		static size_t g_firstPlugIndex;
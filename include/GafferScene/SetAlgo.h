@@ -48,6 +48,9 @@ namespace GafferScene
 namespace SetAlgo
 {
 
+/// Parsed expressions are cached, so repeated evaluation of the same expression
+/// doesn't need to parse it again. Operands are evaluated concurrently using TBB
+/// tasks, so computes calling this function should use `CachePolicy::TaskCollaboration`.
 GAFFERSCENE_API IECore::PathMatcher evaluateSetExpression( const std::string &setExpression, const ScenePlug* scene );
 
 GAFFERSCENE_API IECore::MurmurHash setExpressionHash( const std::string &setExpression, const ScenePlug* scene );
@@ -59,6 +59,7 @@ class GAFFERSCENE_API UVSampler : public PrimitiveSampler
 		bool affectsSamplingFunction( const Gaffer::Plug *input ) const override;
 		void hashSamplingFunction( IECore::MurmurHash &h ) const override;
 		SamplingFunction computeSamplingFunction( const IECoreScene::Primitive *primitive, IECoreScene::PrimitiveVariable::Interpolation &interpolation ) const override;
+		void computeSamplingOrder( const IECoreScene::Primitive *destinationPrimitive, IECoreScene::PrimitiveVariable::Interpolation interpolation, std::vector<size_t> &order ) const override;
 
 	private :
 
@@ -42,6 +42,20 @@
 
 #include "Gaffer/Context.h"
 
+#include "IECore/Export.h"
+#include "IECore/PathMatcher.h"
+
+IECORE_PUSH_DEFAULT_VISIBILITY
+#include "OpenEXR/OpenEXRConfig.h"
+#if OPENEXR_VERSION_MAJOR < 3
+#include "OpenEXR/ImathFrustum.h"
+#include "OpenEXR/ImathLine.h"
+#else
+#include "Imath/ImathFrustum.h"
+#include "Imath/ImathLine.h"
+#endif
+IECORE_POP_DEFAULT_VISIBILITY
+
 namespace GafferSceneTest
 {
 
@@ -50,6 +64,12 @@ namespace GafferSceneTest
 /// any thread related crashes, and also in profiling for performance improvement.
 GAFFERSCENETEST_API void traverseScene( const GafferScene::ScenePlug *scenePlug );
 
+/// Traverses the scene using `SceneAlgo::culledParallelTraverse()`, returning
+/// all the locations visited.
+GAFFERSCENETEST_API IECore::PathMatcher culledTraverseScene( const GafferScene::ScenePlug *scenePlug, const Imath::Box3f &box, const Imath::M44f &worldToBox );
+GAFFERSCENETEST_API IECore::PathMatcher culledTraverseScene( const GafferScene::ScenePlug *scenePlug, const Imath::Line3f &ray, const Imath::M44f &worldToRay );
+GAFFERSCENETEST_API IECore::PathMatcher culledTraverseScene( const GafferScene::ScenePlug *scenePlug, const Imath::Frustumf &frustum, const Imath::M44f &worldToFrustum );
+
 /// Arranges for traverseScene() to be called every time the scene is dirtied. This is useful
 /// for exposing bugs caused by things like InteractiveRender and SceneView, where threaded
 /// traversals will be triggered automatically by plugDirtiedSignal().
@@ -743,6 +743,55 @@ class ArnoldRenderTest( GafferSceneTest.SceneTestCase ) :
 			self.assertEqual( self.__arrayToSet( arnold.AiNodeGetArray( firstSphere, "trace_sets" ) ), { "firstSphere", "group", "bothSpheres" } )
 			self.assertEqual( self.__arrayToSet( arnold.AiNodeGetArray( secondSphere, "trace_sets" ) ), { "secondSphere", "group", "bothSpheres" } )
 
+	def testTraceSetsInSequence( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["sphere"]["out"] )
+		script["group"]["in"][1].setInput( script["sphere"]["out"] )
+
+		script["set"] = GafferScene.Set()
+		script["set"]["name"].setValue( "render:animated" )
+		script["set"]["in"].setInput( script["group"]["out"] )
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( inspect.cleandoc(
+			"""
+			paths = { 1 : [ "/group/sphere" ], 2 : [ "/group/sphere1" ], 3 : [] }
+			parent["set"]["paths"] = IECore.StringVectorData( paths[context.getFrame()] )
+			"""
+		) )
+
+		script["render"] = GafferArnold.ArnoldRender()
+		script["render"]["in"].setInput( script["set"]["out"] )
+		script["render"]["mode"].setValue( script["render"].Mode.SceneDescriptionMode )
+		script["render"]["fileName"].setValue( self.temporaryDirectory() / "test.####.ass" )
+
+		# Render sets are reused from one frame to the next when executing
+		# a sequence, but must still reflect the changes made on each frame.
+
+		script["render"]["task"].executeSequence( [ 1, 2, 3 ] )
+
+		expectedTraceSets = {
+			1 : ( { "animated" }, set() ),
+			2 : ( set(), { "animated" } ),
+			3 : ( set(), set() ),
+		}
+
+		for frame, ( firstSets, secondSets ) in expectedTraceSets.items() :
+
+			with IECoreArnold.UniverseBlock( writable = True ) as universe :
+
+				arnold.AiSceneLoad( universe, str( self.temporaryDirectory() / "test.{:04d}.ass".format( frame ) ), None )
+
+				firstSphere = arnold.AiNodeLookUpByName( universe, "/group/sphere" )
+				secondSphere = arnold.AiNodeLookUpByName( universe, "/group/sphere1" )
+
+				self.assertEqual( self.__arrayToSet( arnold.AiNodeGetArray( firstSphere, "trace_sets" ) ), firstSets )
+				self.assertEqual( self.__arrayToSet( arnold.AiNodeGetArray( secondSphere, "trace_sets" ) ), secondSets )
+
 	def testSetsNeedContextEntry( self ) :
 
 		script = Gaffer.ScriptNode()
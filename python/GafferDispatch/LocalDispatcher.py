@@ -36,10 +36,13 @@
 
 import atexit
 import collections
+import concurrent.futures
 import datetime
 import enum
 import functools
+import json
 import os
+import queue
 import re
 import signal
 import shlex
@@ -64,6 +67,9 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		self["executeInBackground"] = Gaffer.BoolPlug( defaultValue = False )
 		self["ignoreScriptLoadErrors"] = Gaffer.BoolPlug( defaultValue = False )
 		self["environmentCommand"] = Gaffer.StringPlug()
+		self["slots"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+		self["persistentWorkers"] = Gaffer.BoolPlug( defaultValue = False )
+		self["workerMemoryLimit"] = Gaffer.IntPlug( defaultValue = 0, minValue = 0 )
 
 		self.__jobPool = jobPool if jobPool else LocalDispatcher.defaultJobPool()
 
@@ -92,6 +98,9 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__ignoreScriptLoadErrors = dispatcher["ignoreScriptLoadErrors"].getValue()
 			self.__environmentCommand = dispatcher["environmentCommand"].getValue()
 			self.__executeInBackground = dispatcher["executeInBackground"].getValue()
+			self.__slots = dispatcher["slots"].getValue()
+			self.__persistentWorkers = dispatcher["persistentWorkers"].getValue()
+			self.__workerMemoryLimit = dispatcher["workerMemoryLimit"].getValue() * 1024 * 1024
 
 			if self.__executeInBackground :
 				application = script.ancestor( Gaffer.ApplicationRoot )
@@ -110,11 +119,21 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			self.__messagesChangedSignal = Gaffer.Signal1()
 			self.__messageHandler.messagesChangedSignal().connect( Gaffer.WeakMethod( self.__messagesChanged, fallbackResult = None ), scoped = False )
 
+			# List of `( batch, slots )` in an order where each batch follows
+			# all of its preTasks, and the indices of the preTasks for each.
+			self.__batches = []
 			self.__initBatchWalk( batch )
+			self.__preTaskIndices = [
+				{ p.blindData()["localDispatcher:index"].value for p in b.preTasks() }
+				for b, s in self.__batches
+			]
 
 			self.__statusChangedSignal = Gaffer.Signal1()
 
-			self.__currentProcess = None
+			self.__currentProcesses = []
+			self.__currentProcessesMutex = threading.Lock()
+			self.__idleWorkers = []
+			self.__idleWorkersMutex = threading.Lock()
 			self.__status = self.Status.Waiting
 			self.__backgroundTask = None
 
@@ -149,29 +168,22 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			else :
 				return datetime.datetime.now( datetime.timezone.utc ) - self.__startTime
 
+		# When several batches are running concurrently, returns the ID
+		# of the one that was launched first.
 		def processID( self ) :
 
-			return self.__currentProcess.pid if self.__currentProcess is not None else None
+			with self.__currentProcessesMutex :
+				return self.__currentProcesses[0].pid if self.__currentProcesses else None
 
+		# Returns the total across all currently running processes.
 		def memoryUsage( self ) :
 
-			if self.__currentProcess is None :
-				return None
-
-			try :
-				return self.__currentProcess.memory_info().rss
-			except psutil.NoSuchProcess :
-				return None
+			return self.__sumProcesses( lambda p : p.memory_info().rss )
 
+		# Returns the total across all currently running processes.
 		def cpuUsage( self ) :
 
-			if self.__currentProcess is None :
-				return None
-
-			try :
-				return self.__currentProcess.cpu_percent()
-			except psutil.NoSuchProcess :
-				return None
+			return self.__sumProcesses( lambda p : p.cpu_percent() )
 
 		def status( self ) :
 
@@ -216,7 +228,10 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 			with self.__messageHandler :
 				self.__updateStatus( self.Status.Running )
 				try :
-					self.__executeWalk( self.__rootBatch, canceller )
+					try :
+						self.__executeGraph( canceller )
+					finally :
+						self.__shutdownWorkers()
 				except IECore.Cancelled :
 					self.__updateStatus( self.Status.Killed )
 				except :
@@ -226,25 +241,102 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				else :
 					self.__updateStatus( self.Status.Complete )
 
-		def __executeWalk( self, batch, canceller ) :
+		def __executeGraph( self, canceller ) :
 
-			if "localDispatcher:executed" in batch.blindData() :
-				# Visited this batch by another path
+			if self.__slots == 1 or not self.__executeInBackground :
+				# Serial execution. Foreground batches are always executed
+				# this way, since they run in this process and not all nodes
+				# can tolerate concurrent execution.
+				for batch, slots in self.__batches :
+					self.__executeBatchWithMessages( batch, canceller )
 				return
 
-			for upstreamBatch in batch.preTasks() :
-				self.__executeWalk( upstreamBatch, canceller )
+			# Concurrent execution. Batches become ready when all their
+			# preTasks have completed, and ready batches are launched in
+			# order for as long as there are enough free slots for them.
+			# Batches that don't need executing are completed immediately
+			# so that they don't occupy a slot.
+
+			numPendingPreTasks = [ len( p ) for p in self.__preTaskIndices ]
+			postTaskIndices = [ [] for b in self.__batches ]
+			for index, preTaskIndices in enumerate( self.__preTaskIndices ) :
+				for preTaskIndex in preTaskIndices :
+					postTaskIndices[preTaskIndex].append( index )
+
+			ready = collections.deque( i for i, n in enumerate( numPendingPreTasks ) if n == 0 )
+
+			def complete( index ) :
+
+				for postTaskIndex in postTaskIndices[index] :
+					numPendingPreTasks[postTaskIndex] -= 1
+					if numPendingPreTasks[postTaskIndex] == 0 :
+						ready.append( postTaskIndex )
+
+			running = {}
+			freeSlots = self.__slots
+			error = None
+
+			with concurrent.futures.ThreadPoolExecutor( max_workers = self.__slots, thread_name_prefix = "localDispatcherBatch" ) as executor :
+
+				while ready or running :
+
+					while ready and error is None :
+
+						batch, slots = self.__batches[ready[0]]
+						if not self.__requiresExecution( batch ) :
+							complete( ready.popleft() )
+							continue
+
+						slots = min( slots, self.__slots )
+						if slots > freeSlots :
+							break
+
+						if canceller is not None and canceller.cancelled() :
+							# Batches already running will see the cancellation
+							# themselves, and raise `IECore.Cancelled`.
+							error = IECore.Cancelled()
+							break
+
+						freeSlots -= slots
+						future = executor.submit( self.__executeBatchInThread, batch, canceller )
+						running[future] = ( ready.popleft(), slots )
+
+					if not running :
+						break
+
+					done, notDone = concurrent.futures.wait( running, return_when = concurrent.futures.FIRST_COMPLETED )
+					for future in done :
+						index, slots = running.pop( future )
+						freeSlots += slots
+						try :
+							future.result()
+						except Exception as e :
+							# Stop launching new batches, but allow those that are
+							# already running to finish.
+							error = error or e
+						else :
+							complete( index )
 
-			if batch.plug() is None :
-				assert( batch is self.__rootBatch )
-				return
+			if error is not None :
+				raise error
 
-			if len( batch.frames() ) == 0 :
-				# This case occurs for nodes like TaskList and
-				# TaskContextProcessors, because they don't do anything in
-				# execute (they have empty hashes). Their batches exist only to
-				# depend on upstream batches, so we don't need to do any work
-				# here.
+		def __requiresExecution( self, batch ) :
+
+			# Batches without frames occur for nodes like TaskList and
+			# TaskContextProcessors, because they don't do anything in execute
+			# (they have empty hashes). Their batches exist only to depend on
+			# upstream batches, so we don't need to do any work for them. The
+			# root batch has no plug and exists only to hold the others.
+			return batch.plug() is not None and len( batch.frames() ) != 0
+
+		def __executeBatchInThread( self, batch, canceller ) :
+
+			with self.__messageHandler :
+				self.__executeBatchWithMessages( batch, canceller )
+
+		def __executeBatchWithMessages( self, batch, canceller ) :
+
+			if not self.__requiresExecution( batch ) :
 				return
 
 			IECore.Canceller.check( canceller )
@@ -269,7 +361,6 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 						time = datetime.timedelta( seconds = int( 0.5 + time.perf_counter() - startTime ) )
 					)
 				)
-				batch.blindData()["localDispatcher:executed"] = IECore.BoolData( True )
 			except Exception as e :
 				IECore.msg( IECore.MessageHandler.Level.Debug, batch.blindData()["nodeName"].value, traceback.format_exc().strip() )
 				IECore.msg(
@@ -286,50 +377,42 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				batch.execute()
 				return
 
-			# Background execution. Launch a separate process.
-			# Start by building the command arguments.
+			# Background execution. Start by building the context
+			# arguments.
 
 			taskContext = batch.context()
+			nodeName = batch.blindData()["nodeName"].value
 			frames = str( IECore.frameListFromList( [ int(x) for x in batch.frames() ] ) )
 
+			contextArgs = []
+			for entry in [ k for k in taskContext.keys() if k != "frame" and not k.startswith( "ui:" ) ] :
+				if entry not in self.__context.keys() or taskContext[entry] != self.__context[entry] :
+					contextArgs.extend( [ "-" + entry, IECore.repr( taskContext[entry] ) ] )
+
+			if self.__persistentWorkers :
+				self.__executeBatchInWorker( nodeName, frames, contextArgs, canceller )
+				return
+
+			# Launch a separate process for this batch alone.
+
 			args = shlex.split( self.__environmentCommand ) + [
 				str( Gaffer.executablePath() ),
 				"execute",
 				"-script", str( self.__scriptFile ),
-				"-nodes", batch.blindData()["nodeName"].value,
+				"-nodes", nodeName,
 				"-frames", frames,
 			]
 
 			if self.__ignoreScriptLoadErrors :
 				args.append( "-ignoreScriptLoadErrors" )
 
-			contextArgs = []
-			for entry in [ k for k in taskContext.keys() if k != "frame" and not k.startswith( "ui:" ) ] :
-				if entry not in self.__context.keys() or taskContext[entry] != self.__context[entry] :
-					contextArgs.extend( [ "-" + entry, IECore.repr( taskContext[entry] ) ] )
-
 			if contextArgs :
 				args.extend( [ "-context" ] + contextArgs )
 
-			# Build environment. We want to enable all Cortex message levels so
-			# we can capture everything and then let the LocalJobs UI filter
-			# it dynamically.
-
-			env = os.environ.copy()
-			env["IECORE_LOG_LEVEL"] = "DEBUG"
-
-			# Launch process.
-
-			IECore.msg( IECore.Msg.Level.Debug, batch.blindData()["nodeName"].value, "Executing `{}`".format( " ".join( args ) ) )
-
-			platformKW = { "start_new_session" : True } if os.name != "nt" else {}
-			process = subprocess.Popen(
-				args,
-				text = True, stdout = subprocess.PIPE, stderr = subprocess.STDOUT,
-				shell = os.name == "nt" and self.__environmentCommand, env = env,
-				**platformKW,
-			)
-			self.__currentProcess = psutil.Process( process.pid )
+			process = self.__launchProcess( args, nodeName )
+			psutilProcess = psutil.Process( process.pid )
+			with self.__currentProcessesMutex :
+				self.__currentProcesses.append( psutilProcess )
 
 			# Launch a thread to monitor the output stream and feed it into a
 			# our message handler. We must do this on a thread because reading
@@ -349,7 +432,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 			outputHandler = threading.Thread(
 				target = handleOutput,
-				args = [ process.stdout, str( batch.blindData()["nodeName"] ), self.__messageHandler ],
+				args = [ process.stdout, nodeName, self.__messageHandler ],
 				name = "localDispatcherOutputHandler",
 			)
 			outputHandler.start()
@@ -362,11 +445,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				while process.poll() is None :
 
 					if canceller is not None and canceller.cancelled() :
-						if os.name == "nt" :
-							for toKill in self.__currentProcess.children( recursive = True ) + [ self.__currentProcess ] :
-								toKill.kill()
-						else :
-							os.killpg( process.pid, signal.SIGTERM )
+						_killProcess( process, psutilProcess )
 						raise IECore.Cancelled()
 
 					time.sleep( 0.01 )
@@ -379,9 +458,106 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 			finally :
 
-				self.__currentProcess = None
+				with self.__currentProcessesMutex :
+					self.__currentProcesses.remove( psutilProcess )
 				outputHandler.join()
 
+		def __launchProcess( self, args, nodeName, **kw ) :
+
+			# Build environment. We want to enable all Cortex message levels so
+			# we can capture everything and then let the LocalJobs UI filter
+			# it dynamically.
+
+			env = os.environ.copy()
+			env["IECORE_LOG_LEVEL"] = "DEBUG"
+
+			# Launch process.
+
+			IECore.msg( IECore.Msg.Level.Debug, nodeName, "Executing `{}`".format( " ".join( args ) ) )
+
+			platformKW = { "start_new_session" : True } if os.name != "nt" else {}
+			return subprocess.Popen(
+				args,
+				text = True, stdout = subprocess.PIPE, stderr = subprocess.STDOUT,
+				shell = os.name == "nt" and self.__environmentCommand, env = env,
+				**platformKW, **kw
+			)
+
+		def __executeBatchInWorker( self, nodeName, frames, contextArgs, canceller ) :
+
+			worker = self.__acquireWorker( nodeName )
+			with self.__currentProcessesMutex :
+				self.__currentProcesses.append( worker.psutilProcess() )
+
+			try :
+				returnCode = worker.execute( nodeName, frames, contextArgs, canceller )
+			finally :
+				with self.__currentProcessesMutex :
+					self.__currentProcesses.remove( worker.psutilProcess() )
+
+			self.__releaseWorker( worker )
+
+			if returnCode :
+				raise subprocess.CalledProcessError(
+					returnCode,
+					"gaffer execute -worker ({} {})".format( nodeName, frames )
+				)
+
+		def __acquireWorker( self, nodeName ) :
+
+			with self.__idleWorkersMutex :
+				if self.__idleWorkers :
+					return self.__idleWorkers.pop()
+
+			args = shlex.split( self.__environmentCommand ) + [
+				str( Gaffer.executablePath() ),
+				"execute",
+				"-script", str( self.__scriptFile ),
+				"-worker",
+			]
+
+			if self.__ignoreScriptLoadErrors :
+				args.append( "-ignoreScriptLoadErrors" )
+
+			return _Worker( self.__launchProcess( args, nodeName, stdin = subprocess.PIPE ), self.__messageHandler )
+
+		def __releaseWorker( self, worker ) :
+
+			if not worker.alive() :
+				worker.shutdown()
+				return
+
+			if self.__workerMemoryLimit and worker.memoryUsage() > self.__workerMemoryLimit :
+				IECore.msg( IECore.Msg.Level.Debug, "LocalDispatcher", "Recycling worker {} after exceeding memory limit".format( worker.psutilProcess().pid ) )
+				worker.shutdown()
+				return
+
+			with self.__idleWorkersMutex :
+				self.__idleWorkers.append( worker )
+
+		def __shutdownWorkers( self ) :
+
+			with self.__idleWorkersMutex :
+				workers = self.__idleWorkers
+				self.__idleWorkers = []
+
+			for worker in workers :
+				worker.shutdown()
+
+		def __sumProcesses( self, f ) :
+
+			with self.__currentProcessesMutex :
+				processes = list( self.__currentProcesses )
+
+			result = None
+			for process in processes :
+				try :
+					result = ( result or 0 ) + f( process )
+				except psutil.NoSuchProcess :
+					pass
+
+			return result
+
 		def __initBatchWalk( self, batch ) :
 
 			if "nodeName" in batch.blindData() :
@@ -389,13 +565,21 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 				return
 
 			nodeName = ""
+			slots = 1
 			if batch.plug() is not None :
-				nodeName = batch.plug().node().relativeName( batch.plug().node().scriptNode() )
+				node = batch.plug().node()
+				nodeName = node.relativeName( node.scriptNode() )
+				if "local" in node["dispatcher"] :
+					with batch.context() :
+						slots = node["dispatcher"]["local"]["slots"].getValue()
 			batch.blindData()["nodeName"] = nodeName
 
 			for upstreamBatch in batch.preTasks() :
 				self.__initBatchWalk( upstreamBatch )
 
+			batch.blindData()["localDispatcher:index"] = IECore.IntData( len( self.__batches ) )
+			self.__batches.append( ( batch, slots ) )
+
 		def __updateStatus( self, status ) :
 
 			if status == self.__status :
@@ -496,6 +680,15 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 
 		return self.__jobPool
 
+	@staticmethod
+	def _setupPlugs( parentPlug ) :
+
+		if "local" in parentPlug :
+			return
+
+		parentPlug["local"] = Gaffer.Plug()
+		parentPlug["local"]["slots"] = Gaffer.IntPlug( defaultValue = 1, minValue = 1 )
+
 	def _doDispatch( self, batch ) :
 
 		job = LocalDispatcher.Job(
@@ -507,7 +700,7 @@ class LocalDispatcher( GafferDispatch.Dispatcher ) :
 		job._execute()
 
 IECore.registerRunTimeTyped( LocalDispatcher, typeName = "GafferDispatch::LocalDispatcher" )
-GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher )
+GafferDispatch.Dispatcher.registerDispatcher( "Local", LocalDispatcher, LocalDispatcher._setupPlugs )
 
 ## \todo Should this be a shared component implemented in C++ in `Messages.h`?
 # It is incredibly similar to the handler in `InteractiveRender.cpp`.
@@ -557,6 +750,119 @@ class _MessageHandler( IECore.MessageHandler ) :
 
 		self.__messagesChangedSignal()
 
+def _killProcess( process, psutilProcess ) :
+
+	if os.name == "nt" :
+		for toKill in psutilProcess.children( recursive = True ) + [ psutilProcess ] :
+			toKill.kill()
+	else :
+		os.killpg( process.pid, signal.SIGTERM )
+
+# Prefix for the lines reporting batch results from `gaffer execute -worker`.
+# The `execute` app imports this, so there is a single definition. Results
+# share `stdout` with the output of the tasks themselves, so they are preceded
+# by a newline in case the task output was not terminated by one.
+_workerResultPrefix = "__gafferExecuteWorkerResult__ "
+
+# A persistent `gaffer execute -worker` process, which loads the script once
+# and then executes batches on request. This avoids paying the cost of process
+# launch and script loading for every batch.
+class _Worker( object ) :
+
+	def __init__( self, process, messageHandler ) :
+
+		self.__process = process
+		self.__psutilProcess = psutil.Process( process.pid )
+		self.__messageContext = ""
+		self.__results = queue.Queue()
+
+		self.__outputHandler = threading.Thread(
+			target = self.__handleOutput,
+			args = [ messageHandler ],
+			name = "localDispatcherWorkerOutputHandler",
+		)
+		self.__outputHandler.start()
+
+	def psutilProcess( self ) :
+
+		return self.__psutilProcess
+
+	def alive( self ) :
+
+		return self.__process.poll() is None
+
+	def memoryUsage( self ) :
+
+		try :
+			return self.__psutilProcess.memory_info().rss
+		except psutil.NoSuchProcess :
+			return 0
+
+	# Executes a batch, returning the return code. If cancellation is
+	# requested, the worker is killed and `IECore.Cancelled` is raised.
+	def execute( self, nodeName, frames, contextArgs, canceller ) :
+
+		self.__messageContext = nodeName
+
+		try :
+			self.__process.stdin.write(
+				json.dumps( { "nodes" : [ nodeName ], "frames" : frames, "context" : contextArgs } ) + "\n"
+			)
+			self.__process.stdin.flush()
+		except OSError :
+			# The worker has exited, most likely because it failed to load
+			# the script. We'll get a result of `None` below.
+			pass
+
+		while True :
+			try :
+				result = self.__results.get( timeout = 0.01 )
+				break
+			except queue.Empty :
+				if canceller is not None and canceller.cancelled() :
+					self.kill()
+					raise IECore.Cancelled()
+
+		if result is None :
+			# The worker exited without completing the batch.
+			self.__process.wait()
+			self.__outputHandler.join()
+			return self.__process.returncode or 1
+
+		return result
+
+	def shutdown( self ) :
+
+		try :
+			self.__process.stdin.close()
+		except OSError :
+			pass
+
+		self.__process.wait()
+		self.__outputHandler.join()
+
+	def kill( self ) :
+
+		_killProcess( self.__process, self.__psutilProcess )
+		self.__process.wait()
+		self.__outputHandler.join()
+
+	def __handleOutput( self, messageHandler ) :
+
+		for line in iter( self.__process.stdout.readline, "" ) :
+			if line == "\n" :
+				# Either the newline preceding a result, or an empty line
+				# of task output. Neither is worth reporting.
+				continue
+			elif line.startswith( _workerResultPrefix ) :
+				self.__results.put( int( line[len(_workerResultPrefix):] ) )
+			else :
+				message, level = _messageLevel( line[:-1] )
+				messageHandler.handle( level, self.__messageContext, message )
+
+		self.__process.stdout.close()
+		self.__results.put( None )
+
 __messageLevelRE = re.compile(
 	r"(DEBUG|INFO|WARNING|ERROR) +[:|] ",
 )
@@ -36,6 +36,7 @@
 ##########################################################################
 
 import os
+import json
 import pathlib
 import subprocess
 import unittest
@@ -372,5 +373,91 @@ class ExecuteApplicationTest( GafferTest.TestCase ) :
 		validate( sequence = True )
 		validate( sequence = False )
 
+	def testWorker( self ) :
+
+		s = Gaffer.ScriptNode()
+
+		s["write"] = GafferDispatchTest.TextWriter()
+		s["write"]["fileName"].setValue( pathlib.Path( self.__outputFileSeq.fileName ) )
+		s["write"]["text"].setValue( "${value}" )
+
+		s["fileName"].setValue( self.__scriptFileName )
+		s.save()
+
+		p = subprocess.Popen(
+			[ str( Gaffer.executablePath() ), "execute", str( self.__scriptFileName ), "-worker" ],
+			stdin = subprocess.PIPE,
+			stdout = subprocess.PIPE,
+			universal_newlines = True,
+		)
+
+		def execute( nodes, frames, context ) :
+
+			p.stdin.write( json.dumps( { "nodes" : nodes, "frames" : frames, "context" : context } ) + "\n" )
+			p.stdin.flush()
+			# Results are preceded by a newline, in case task output
+			# wasn't terminated by one.
+			self.assertEqual( p.stdout.readline(), "\n" )
+			return p.stdout.readline()
+
+		from GafferDispatch.LocalDispatcher import _workerResultPrefix as prefix
+		self.assertEqual( execute( [ "write" ], "1-2", [ "-value", "'a'" ] ), prefix + "0\n" )
+		self.assertEqual( execute( [ "write" ], "3", [ "-value", "'b'" ] ), prefix + "0\n" )
+		self.assertEqual( execute( [ "notANode" ], "1", [] ), prefix + "1\n" )
+
+		p.stdin.close()
+		p.wait()
+		self.assertEqual( p.returncode, 0 )
+
+		for frame, text in [ ( 1, "a" ), ( 2, "a" ), ( 3, "b" ) ] :
+			with open( pathlib.Path( self.__outputFileSeq.fileNameForFrame( frame ) ), encoding = "utf-8" ) as f :
+				self.assertEqual( f.read(), text )
+
+	def testWorkerDoesntReuseCachedResults( self ) :
+
+		inputFileName = self.temporaryDirectory() / "input.txt"
+		with open( inputFileName, "w", encoding = "utf-8" ) as f :
+			f.write( "a" )
+
+		s = Gaffer.ScriptNode()
+
+		s["write"] = GafferDispatchTest.TextWriter()
+		s["write"]["fileName"].setValue( pathlib.Path( self.__outputTextFile ) )
+
+		# The expression hash doesn't depend on the contents of the file.
+		s["expression"] = Gaffer.Expression()
+		s["expression"].setExpression( 'parent["write"]["text"] = open( "{}", encoding = "utf-8" ).read()'.format( inputFileName.as_posix() ) )
+
+		s["fileName"].setValue( self.__scriptFileName )
+		s.save()
+
+		p = subprocess.Popen(
+			[ str( Gaffer.executablePath() ), "execute", str( self.__scriptFileName ), "-worker" ],
+			stdin = subprocess.PIPE,
+			stdout = subprocess.PIPE,
+			universal_newlines = True,
+		)
+
+		from GafferDispatch.LocalDispatcher import _workerResultPrefix as prefix
+
+		for text in [ "a", "b" ] :
+
+			with open( inputFileName, "w", encoding = "utf-8" ) as f :
+				f.write( text )
+
+			p.stdin.write( json.dumps( { "nodes" : [ "write" ], "frames" : "1", "context" : [] } ) + "\n" )
+			p.stdin.flush()
+			self.assertEqual( p.stdout.readline(), "\n" )
+			self.assertEqual( p.stdout.readline(), prefix + "0\n" )
+
+			# Each batch must see the current contents of the input file,
+			# as it would if it had a process of its own.
+			with open( self.__outputTextFile, encoding = "utf-8" ) as f :
+				self.assertEqual( f.read(), text )
+
+		p.stdin.close()
+		p.wait()
+		self.assertEqual( p.returncode, 0 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -1292,5 +1292,356 @@ class LocalDispatcherTest( GafferTest.TestCase ) :
 
 		self.assertTrue( fileToCreate.is_file() )
 
+	def testConcurrentBatches( self ) :
+
+		directory = self.temporaryDirectory()
+
+		# `a` and `b` can only complete if they are executed
+		# concurrently, because each waits for the other to start.
+		# `c` must wait for both to complete.
+
+		script = Gaffer.ScriptNode()
+		for name, other in [ ( "a", "b" ), ( "b", "a" ) ] :
+			script[name] = GafferDispatch.PythonCommand()
+			script[name]["command"].setValue( inspect.cleandoc(
+				f"""
+				import pathlib, time
+				directory = pathlib.Path( "{directory.as_posix()}" )
+				( directory / "{name}Started" ).touch()
+				startTime = time.time()
+				while not ( directory / "{other}Started" ).exists() :
+					if time.time() - startTime > 30 :
+						raise RuntimeError( "Timed out waiting for `{other}`" )
+					time.sleep( 0.01 )
+				( directory / "{name}Completed" ).touch()
+				"""
+			) )
+
+		script["c"] = GafferDispatch.PythonCommand()
+		script["c"]["preTasks"][0].setInput( script["a"]["task"] )
+		script["c"]["preTasks"][1].setInput( script["b"]["task"] )
+		script["c"]["command"].setValue( inspect.cleandoc(
+			f"""
+			import pathlib
+			directory = pathlib.Path( "{directory.as_posix()}" )
+			assert( ( directory / "aCompleted" ).exists() )
+			assert( ( directory / "bCompleted" ).exists() )
+			( directory / "cCompleted" ).touch()
+			"""
+		) )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["c"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["slots"].setValue( 2 )
+		dispatcher["task"].execute()
+		dispatcher.jobPool().waitForAll()
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Complete )
+		self.assertTrue( ( directory / "cCompleted" ).is_file() )
+
+	def testSlotsPerTask( self ) :
+
+		directory = self.temporaryDirectory()
+
+		# Each task occupies all the slots, so they must not
+		# overlap even though they are independent.
+
+		script = Gaffer.ScriptNode()
+		for name in [ "a", "b" ] :
+			script[name] = GafferDispatch.PythonCommand()
+			script[name]["dispatcher"]["local"]["slots"].setValue( 2 )
+			script[name]["command"].setValue( inspect.cleandoc(
+				f"""
+				import pathlib, time
+				directory = pathlib.Path( "{directory.as_posix()}" )
+				assert( not ( directory / "running" ).exists() )
+				( directory / "running" ).touch()
+				time.sleep( 0.5 )
+				( directory / "running" ).unlink()
+				( directory / "{name}Completed" ).touch()
+				"""
+			) )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["a"]["task"] )
+		dispatcher["tasks"][1].setInput( script["b"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["slots"].setValue( 2 )
+		dispatcher["task"].execute()
+		dispatcher.jobPool().waitForAll()
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Complete )
+		self.assertTrue( ( directory / "aCompleted" ).is_file() )
+		self.assertTrue( ( directory / "bCompleted" ).is_file() )
+
+	def testKillConcurrentBatches( self ) :
+
+		directory = self.temporaryDirectory()
+
+		script = Gaffer.ScriptNode()
+		for name in [ "a", "b" ] :
+			script[name] = GafferDispatch.PythonCommand()
+			script[name]["command"].setValue( inspect.cleandoc(
+				f"""
+				import pathlib, time
+				( pathlib.Path( "{directory.as_posix()}" ) / "{name}Started" ).touch()
+				time.sleep( 1000000 )
+				"""
+			) )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["a"]["task"] )
+		dispatcher["tasks"][1].setInput( script["b"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["slots"].setValue( 2 )
+		dispatcher["task"].execute()
+
+		job = dispatcher.jobPool().jobs()[0]
+		startTime = time.time()
+		while not ( ( directory / "aStarted" ).exists() and ( directory / "bStarted" ).exists() ) :
+			self.assertLess( time.time() - startTime, 30 )
+			time.sleep( 0.01 )
+
+		self.assertIsNotNone( job.processID() )
+		self.assertIsNotNone( job.memoryUsage() )
+
+		job.kill()
+		dispatcher.jobPool().waitForAll()
+		self.assertEqual( job.status(), job.Status.Killed )
+		self.assertIsNone( job.processID() )
+
+	def __pidWriter( self, directory ) :
+
+		result = GafferDispatch.PythonCommand()
+		result["command"].setValue( inspect.cleandoc(
+			f"""
+			import os, pathlib
+			( pathlib.Path( "{directory.as_posix()}" ) / "{{}}.txt".format( context.getFrame() ) ).write_text( str( os.getpid() ) )
+			"""
+		) )
+
+		return result
+
+	def testPersistentWorkers( self ) :
+
+		directory = self.temporaryDirectory()
+
+		script = Gaffer.ScriptNode()
+		script["writer"] = self.__pidWriter( directory )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["writer"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["persistentWorkers"].setValue( True )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-5" )
+		dispatcher["task"].execute()
+		dispatcher.jobPool().waitForAll()
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Complete )
+		self.assertIsNone( job.processID() )
+
+		# All batches were executed by the same worker, which has
+		# been shut down now that the job is complete.
+
+		pids = { ( directory / f"{f}.txt" ).read_text() for f in range( 1, 6 ) }
+		self.assertEqual( len( pids ), 1 )
+		if os.name != "nt" :
+			with self.assertRaises( OSError ) as check :
+				os.kill( int( pids.pop() ), 0 )
+			self.assertEqual( check.exception.errno, errno.ESRCH )
+
+	def testPersistentWorkersWithConcurrentBatches( self ) :
+
+		directory = self.temporaryDirectory()
+
+		script = Gaffer.ScriptNode()
+		script["writer"] = self.__pidWriter( directory )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["writer"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["persistentWorkers"].setValue( True )
+		dispatcher["slots"].setValue( 2 )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-10" )
+		dispatcher["task"].execute()
+		dispatcher.jobPool().waitForAll()
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Complete )
+
+		pids = { ( directory / f"{f}.txt" ).read_text() for f in range( 1, 11 ) }
+		self.assertLessEqual( len( pids ), 2 )
+
+	def testPersistentWorkerMemoryLimit( self ) :
+
+		directory = self.temporaryDirectory()
+
+		script = Gaffer.ScriptNode()
+		script["writer"] = self.__pidWriter( directory )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["writer"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["persistentWorkers"].setValue( True )
+		# Any worker will exceed this, so must be replaced after every batch.
+		dispatcher["workerMemoryLimit"].setValue( 1 )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-3" )
+		dispatcher["task"].execute()
+		dispatcher.jobPool().waitForAll()
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Complete )
+
+		pids = { ( directory / f"{f}.txt" ).read_text() for f in range( 1, 4 ) }
+		self.assertEqual( len( pids ), 3 )
+
+	def testPersistentWorkerFailure( self ) :
+
+		directory = self.temporaryDirectory()
+
+		script = Gaffer.ScriptNode()
+		script["command"] = GafferDispatch.PythonCommand()
+		script["command"]["command"].setValue( inspect.cleandoc(
+			f"""
+			import pathlib
+			if context.getFrame() == 2 :
+				raise RuntimeError( "Oops" )
+			( pathlib.Path( "{directory.as_posix()}" ) / "{{}}.txt".format( context.getFrame() ) ).touch()
+			"""
+		) )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["command"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["persistentWorkers"].setValue( True )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-3" )
+		dispatcher["task"].execute()
+		dispatcher.jobPool().waitForAll()
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Failed )
+		self.assertTrue( ( directory / "1.txt" ).is_file() )
+		self.assertFalse( ( directory / "3.txt" ).exists() )
+
+		self.assertTrue( any(
+			m.context == "command" and "Oops" in m.message
+			for m in job.messages()
+		) )
+
+	def testPersistentWorkerOutputWithoutNewline( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["command"] = GafferDispatch.PythonCommand()
+		script["command"]["command"].setValue( inspect.cleandoc(
+			"""
+			import sys
+			sys.stdout.write( "noNewline{}".format( context.getFrame() ) )
+			sys.stdout.flush()
+			"""
+		) )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["command"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["persistentWorkers"].setValue( True )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-2" )
+		dispatcher["task"].execute()
+		dispatcher.jobPool().waitForAll()
+
+		# The output doesn't prevent the worker's results from being
+		# recognised, and is reported as normal.
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Complete )
+
+		messages = [ m.message for m in job.messages() if m.context == "command" ]
+		self.assertIn( "noNewline1", messages )
+		self.assertIn( "noNewline2", messages )
+		self.assertNotIn( "", messages )
+
+	def testKillPersistentWorker( self ) :
+
+		directory = self.temporaryDirectory()
+
+		script = Gaffer.ScriptNode()
+		script["command"] = GafferDispatch.PythonCommand()
+		script["command"]["command"].setValue( inspect.cleandoc(
+			f"""
+			import pathlib, time
+			( pathlib.Path( "{directory.as_posix()}" ) / "started" ).touch()
+			time.sleep( 1000000 )
+			"""
+		) )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["command"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["persistentWorkers"].setValue( True )
+		dispatcher["task"].execute()
+
+		job = dispatcher.jobPool().jobs()[0]
+		startTime = time.time()
+		while not ( directory / "started" ).exists() :
+			self.assertLess( time.time() - startTime, 30 )
+			time.sleep( 0.01 )
+
+		pid = job.processID()
+		self.assertIsNotNone( pid )
+
+		job.kill()
+		dispatcher.jobPool().waitForAll()
+		self.assertEqual( job.status(), job.Status.Killed )
+
+		if os.name != "nt" :
+			with self.assertRaises( OSError ) as check :
+				os.kill( pid, 0 )
+			self.assertEqual( check.exception.errno, errno.ESRCH )
+
+	def __dispatchShortBatches( self, persistentWorkers ) :
+
+		script = Gaffer.ScriptNode()
+		script["command"] = GafferDispatch.PythonCommand()
+		script["command"]["command"].setValue( "context.getFrame()" )
+
+		dispatcher = self.__createLocalDispatcher()
+		dispatcher["tasks"][0].setInput( script["command"]["task"] )
+		dispatcher["executeInBackground"].setValue( True )
+		dispatcher["persistentWorkers"].setValue( persistentWorkers )
+		dispatcher["framesMode"].setValue( dispatcher.FramesMode.CustomRange )
+		dispatcher["frameRange"].setValue( "1-20" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			dispatcher["task"].execute()
+			dispatcher.jobPool().waitForAll()
+
+		job = dispatcher.jobPool().jobs()[0]
+		self.assertEqual( job.status(), job.Status.Complete )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1, acceptableDifference = 1 )
+	def testProcessPerBatchPerformance( self ) :
+
+		self.__dispatchShortBatches( persistentWorkers = False )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1, acceptableDifference = 1 )
+	def testPersistentWorkersPerformance( self ) :
+
+		self.__dispatchShortBatches( persistentWorkers = True )
+
+	def testTaskPlugs( self ) :
+
+		node = GafferDispatchTest.LoggingTaskNode()
+		self.assertIsInstance( node["dispatcher"]["local"]["slots"], Gaffer.IntPlug )
+		self.assertEqual( node["dispatcher"]["local"]["slots"].getValue(), 1 )
+		self.assertEqual( node["dispatcher"]["local"]["slots"].minValue(), 1 )
+
 if __name__ == "__main__":
 	unittest.main()
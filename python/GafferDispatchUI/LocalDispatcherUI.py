@@ -48,6 +48,7 @@ Gaffer.Metadata.registerNode(
 	""",
 
 	"layout:activator:executeInBackgroundIsOn", lambda node : node["executeInBackground"].getValue(),
+	"layout:activator:persistentWorkersIsOn", lambda node : node["executeInBackground"].getValue() and node["persistentWorkers"].getValue(),
 
 	plugs = {
 
@@ -97,6 +98,90 @@ Gaffer.Metadata.registerNode(
 
 		),
 
+		"slots" : (
+
+			"description",
+			"""
+			The number of slots available for executing batches concurrently
+			in the background. Independent batches are launched as separate
+			processes for as long as there are enough free slots for them,
+			with each batch occupying the number of slots specified by the
+			`dispatcher.local.slots` plug on its node. Batches are still
+			executed only after all of their preTasks have completed.
+			Foreground execution is always serial.
+			""",
+
+			"layout:activator", "executeInBackgroundIsOn",
+
+		),
+
+		"persistentWorkers" : (
+
+			"description",
+			"""
+			Executes background batches in persistent worker processes, each of
+			which loads the script once and then executes any number of batches.
+			This avoids the overhead of launching a new process and loading the
+			script for every batch, which can dominate for short tasks. Workers
+			are shut down when the job completes.
+
+			> Caution : Any state left behind by one batch, such as a modified
+			> environment or global variables, will be seen by subsequent batches
+			> executed by the same worker.
+			""",
+
+			"layout:activator", "executeInBackgroundIsOn",
+
+		),
+
+		"workerMemoryLimit" : (
+
+			"description",
+			"""
+			The memory limit for persistent workers, in megabytes. Workers exceeding
+			the limit after executing a batch are shut down, and replaced with new
+			ones for subsequent batches. A value of 0 means there is no limit.
+			""",
+
+			"layout:activator", "persistentWorkersIsOn",
+
+		),
+
+	}
+
+)
+
+Gaffer.Metadata.registerNode(
+
+	GafferDispatch.TaskNode,
+
+	plugs = {
+
+		"dispatcher.local" : (
+
+			"description",
+			"""
+			Settings that control how tasks are
+			dispatched by the LocalDispatcher.
+			""",
+
+			"layout:section", "Local",
+			"plugValueWidget:type", "GafferUI.LayoutPlugValueWidget",
+
+		),
+
+		"dispatcher.local.slots" : (
+
+			"description",
+			"""
+			The number of LocalDispatcher slots occupied by each batch
+			of this task while it executes. Increase this for tasks that
+			use many cores or a lot of memory, to limit the number of
+			other batches that can run alongside them.
+			""",
+
+		),
+
 	}
 
 )
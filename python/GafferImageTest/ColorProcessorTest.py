@@ -0,0 +1,214 @@
+##########################################################################
+#
+#  Copyright (c) 2026, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+import imath
+
+import IECore
+
+import Gaffer
+import GafferTest
+import GafferImage
+import GafferImageTest
+
+class ColorProcessorTest( GafferImageTest.ImageTestCase ) :
+
+	def __chain( self, image, separate ) :
+
+		# Builds a chain of ColorProcessors, optionally separated by
+		# a non-ColorProcessor node to prevent them being fused.
+
+		result = Gaffer.Node()
+		result["saturation1"] = GafferImage.Saturation()
+		result["saturation1"]["saturation"].setValue( 0.5 )
+		result["cdl"] = GafferImage.CDL()
+		result["cdl"]["slope"].setValue( imath.Color3f( 1.2, 0.9, 1.1 ) )
+		result["cdl"]["offset"].setValue( imath.Color3f( 0.01, 0.02, 0.03 ) )
+		result["saturation2"] = GafferImage.Saturation()
+		result["saturation2"]["saturation"].setValue( 1.5 )
+
+		upstream = image
+		for name in [ "saturation1", "cdl", "saturation2" ] :
+			if separate :
+				result[name + "Separator"] = GafferImage.Grade()
+				result[name + "Separator"]["in"].setInput( upstream )
+				upstream = result[name + "Separator"]["out"]
+			result[name]["in"].setInput( upstream )
+			upstream = result[name]["out"]
+
+		return result
+
+	def testFusedChain( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.5, 0.2, 0.5 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.8, 0.3, 0.6, 1 ) )
+
+		fused = self.__chain( checker["out"], separate = False )
+		separate = self.__chain( checker["out"], separate = True )
+
+		# Final and intermediate results should all match the
+		# unfused versions.
+
+		for name in [ "saturation1", "cdl", "saturation2" ] :
+			self.assertImagesEqual( fused[name]["out"], separate[name]["out"], maxDifference = 1e-6 )
+
+		# And the intermediate results should not be computed when
+		# only the end of the chain is evaluated.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( fused["saturation2"]["out"] )
+
+		self.assertGreater( monitor.plugStatistics( fused["saturation2"]["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( fused["cdl"]["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( fused["saturation1"]["__colorData"] ).computeCount, 0 )
+
+	def testUnfusableChain( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.5, 0.2, 0.5 ) )
+
+		fused = self.__chain( checker["out"], separate = False )
+		separate = self.__chain( checker["out"], separate = True )
+
+		# Processing a subset of channels prevents fusion.
+		for chain in ( fused, separate ) :
+			chain["cdl"]["channels"].setValue( "R" )
+
+		self.assertImagesEqual( fused["saturation2"]["out"], separate["saturation2"]["out"], maxDifference = 1e-6 )
+
+		# As does a mismatch in `processUnpremultiplied`.
+		for chain in ( fused, separate ) :
+			chain["cdl"]["channels"].setValue( "[RGB]" )
+			chain["cdl"]["processUnpremultiplied"].setValue( True )
+
+		self.assertImagesEqual( fused["saturation2"]["out"], separate["saturation2"]["out"], maxDifference = 1e-6 )
+
+		# Disabled nodes are skipped.
+		for chain in ( fused, separate ) :
+			chain["cdl"]["enabled"].setValue( False )
+
+		self.assertImagesEqual( fused["saturation2"]["out"], separate["saturation2"]["out"], maxDifference = 1e-6 )
+
+	def testMixedPremultiplication( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.5, 0.2, 0.5 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.8, 0.3, 0.6, 0.25 ) )
+
+		fused = self.__chain( checker["out"], separate = False )
+		separate = self.__chain( checker["out"], separate = True )
+
+		# Add a premultiplied processor to the end of the chain, and switch
+		# the middle of the chain to processing unpremultiplied. Only the
+		# processors with matching settings can be fused.
+
+		for chain in ( fused, separate ) :
+			chain["saturation3"] = GafferImage.Saturation()
+			chain["saturation3"]["saturation"].setValue( 0.75 )
+			chain["saturation3"]["in"].setInput( chain["saturation2"]["out"] )
+			chain["cdl"]["processUnpremultiplied"].setValue( True )
+			chain["saturation2"]["processUnpremultiplied"].setValue( True )
+
+		for name in [ "saturation1", "cdl", "saturation2", "saturation3" ] :
+			self.assertImagesEqual( fused[name]["out"], separate[name]["out"], maxDifference = 1e-6 )
+
+		# The unpremultiplied processors are fused with each other, but not
+		# with their premultiplied neighbours, whose outputs must be computed.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( fused["saturation3"]["out"] )
+
+		self.assertGreater( monitor.plugStatistics( fused["saturation3"]["__colorData"] ).computeCount, 0 )
+		self.assertGreater( monitor.plugStatistics( fused["saturation2"]["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( fused["cdl"]["__colorData"] ).computeCount, 0 )
+		self.assertGreater( monitor.plugStatistics( fused["saturation1"]["__colorData"] ).computeCount, 0 )
+
+	def testMissingChannels( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["colorA"].setValue( imath.Color4f( 0.1, 0.5, 0.2, 0.5 ) )
+		checker["colorB"].setValue( imath.Color4f( 0.8, 0.3, 0.6, 1 ) )
+
+		deleteChannels = GafferImage.DeleteChannels()
+		deleteChannels["in"].setInput( checker["out"] )
+		deleteChannels["mode"].setValue( GafferImage.DeleteChannels.Mode.Keep )
+		deleteChannels["channels"].setValue( "R A" )
+
+		fused = self.__chain( deleteChannels["out"], separate = False )
+		separate = self.__chain( deleteChannels["out"], separate = True )
+
+		# Each processor writes into G and B, but they don't exist in the
+		# image, so the next processor must still read them as black.
+
+		for name in [ "saturation1", "cdl", "saturation2" ] :
+			self.assertEqual( fused[name]["out"].channelNames(), IECore.StringVectorData( [ "R", "A" ] ) )
+			self.assertImagesEqual( fused[name]["out"], separate[name]["out"], maxDifference = 1e-6 )
+
+		# The chain is still fused.
+
+		Gaffer.ValuePlug.clearCache()
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferImageTest.processTiles( fused["saturation2"]["out"] )
+
+		self.assertEqual( monitor.plugStatistics( fused["cdl"]["__colorData"] ).computeCount, 0 )
+		self.assertEqual( monitor.plugStatistics( fused["saturation1"]["__colorData"] ).computeCount, 0 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testFusedChainPerformance( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 4096, 4096 ) )
+
+		upstream = checker["out"]
+		saturations = []
+		for i in range( 0, 5 ) :
+			saturation = GafferImage.Saturation()
+			saturation["in"].setInput( upstream )
+			saturation["saturation"].setValue( 0.9 + i * 0.05 )
+			saturations.append( saturation )
+			upstream = saturation["out"]
+
+		GafferImageTest.processTiles( checker["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( upstream )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -89,6 +89,62 @@ class CropTest( GafferImageTest.ImageTestCase ) :
 		self.assertNotEqual( i["out"]["format"].getValue(), crop["out"]["format"].getValue() )
 		self.assertNotEqual( i["out"]["dataWindow"].getValue(), crop["out"]["dataWindow"].getValue() )
 
+	def testTileAlignedAreaSharesChannelData( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 1024, 1024 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( checker["out"] )
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+		crop["area"].setValue( imath.Box2i( imath.V2i( tileSize * 2, tileSize ), imath.V2i( tileSize * 6 + 10, tileSize * 5 ) ) )
+
+		# All tiles should be shared with the input, including the partially
+		# covered tiles on the border of the data window.
+
+		def assertShared() :
+			offset = crop["area"].getValue().min if crop["resetOrigin"].getValue() else imath.V2i( 0 )
+			dataWindow = crop["out"]["dataWindow"].getValue()
+			for y in range( dataWindow.min().y, dataWindow.max().y, tileSize ) :
+				for x in range( dataWindow.min().x, dataWindow.max().x, tileSize ) :
+					tileOrigin = imath.V2i( x, y )
+					self.assertTrue(
+						crop["out"].channelData( "R", tileOrigin, _copy = False ).isSame(
+							checker["out"].channelData( "R", tileOrigin + offset, _copy = False )
+						)
+					)
+
+		for resetOrigin in ( True, False ) :
+			crop["resetOrigin"].setValue( resetOrigin )
+			assertShared()
+
+	def testTileAlignedAreaMemoryUsage( self ) :
+
+		checker = GafferImage.Checkerboard()
+		checker["format"].setValue( GafferImage.Format( 2048, 2048 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( checker["out"] )
+
+		tileSize = GafferImage.ImagePlug.tileSize()
+
+		def cropMemoryUsage( area ) :
+
+			Gaffer.ValuePlug.clearCache()
+			GafferImageTest.processTiles( checker["out"] )
+			before = Gaffer.ValuePlug.cacheMemoryUsage()
+			crop["area"].setValue( area )
+			GafferImageTest.processTiles( crop["out"] )
+			return Gaffer.ValuePlug.cacheMemoryUsage() - before
+
+		alignedUsage = cropMemoryUsage( imath.Box2i( imath.V2i( tileSize ), imath.V2i( tileSize * 24 ) ) )
+		unalignedUsage = cropMemoryUsage( imath.Box2i( imath.V2i( tileSize + 1 ), imath.V2i( tileSize * 24 + 1 ) ) )
+
+		# The aligned crop shares all its tiles with the input, so should use
+		# only a tiny fraction of the memory used by the unaligned crop.
+		self.assertLess( alignedUsage, unalignedUsage / 10 )
+
 	def testEnableBehaviour( self ) :
 
 		crop = GafferImage.Crop()
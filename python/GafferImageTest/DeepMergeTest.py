@@ -375,6 +375,64 @@ class DeepMergeTest( GafferImageTest.ImageTestCase ) :
 
 		return IECore.FloatVectorData( data )
 
+	def testEmptyAndSingleInputTiles( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 192, 64 ) )
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 1.0, 0.5 ) )
+
+		flatToDeep = GafferImage.FlatToDeep()
+		flatToDeep["in"].setInput( constant["out"] )
+
+		cropLeft = GafferImage.Crop()
+		cropLeft["in"].setInput( flatToDeep["out"] )
+		cropLeft["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 64 ) ) )
+
+		cropRight = GafferImage.Crop()
+		cropRight["in"].setInput( flatToDeep["out"] )
+		cropRight["area"].setValue( imath.Box2i( imath.V2i( 128, 0 ), imath.V2i( 192, 64 ) ) )
+
+		merge = GafferImage.DeepMerge()
+		merge["in"][0].setInput( cropLeft["out"] )
+		merge["in"][1].setInput( cropRight["out"] )
+
+		# Where only one input has samples, its data can be passed through
+		# untouched.
+		for tileOrigin, inputImage in [ ( imath.V2i( 0 ), cropLeft ), ( imath.V2i( 128, 0 ), cropRight ) ] :
+			self.assertTrue(
+				merge["out"].sampleOffsets( tileOrigin, _copy = False ).isSame(
+					GafferImage.ImagePlug.flatTileSampleOffsets( _copy = False )
+				)
+			)
+			for channelName in [ "R", "G", "B", "A", "Z" ] :
+				self.assertTrue(
+					merge["out"].channelData( channelName, tileOrigin, _copy = False ).isSame(
+						inputImage["out"].channelData( channelName, tileOrigin, _copy = False )
+					)
+				)
+
+		# Where neither input has samples, the output is empty.
+		self.assertTrue(
+			merge["out"].sampleOffsets( imath.V2i( 64, 0 ), _copy = False ).isSame(
+				GafferImage.ImagePlug.emptyTileSampleOffsets( _copy = False )
+			)
+		)
+		self.assertEqual( merge["out"].channelData( "R", imath.V2i( 64, 0 ) ), IECore.FloatVectorData() )
+
+		sampleCounts = GafferImage.DeepSampleCounts()
+		sampleCounts["in"].setInput( merge["out"] )
+
+		self.assertTrue(
+			sampleCounts["out"].channelData( "R", imath.V2i( 0 ), _copy = False ).isSame(
+				GafferImage.ImagePlug.whiteTile( _copy = False )
+			)
+		)
+		self.assertTrue(
+			sampleCounts["out"].channelData( "R", imath.V2i( 64, 0 ), _copy = False ).isSame(
+				GafferImage.ImagePlug.blackTile( _copy = False )
+			)
+		)
+
 	def __getExpectedSampleOffsets( self, tileOrigin, area1, area2 ) :
 
 		ts = GafferImage.ImagePlug.tileSize()
@@ -932,6 +932,78 @@ class DeepStateTest( GafferImageTest.ImageTestCase ) :
 			# As in prev test, this is large enough to cause precision problems, but things should still mostly work
 			self.__assertDeepStateProcessing( giantDepthOffset["out"], firstResult["out"], [ 0.7, 0.7, 0.7, 0.000004 ], [ 0.002, 0.002, 0.002, 0.0000002 ], min( expectedMaxPrune, 20 ), expectedAveragePrune )
 
+	def testTrivialSampleLayouts( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 192, 64 ) )
+		constant["color"].setValue( imath.Color4f( 0.25, 0.5, 1.0, 0.5 ) )
+
+		flatToDeep = GafferImage.FlatToDeep()
+		flatToDeep["in"].setInput( constant["out"] )
+		flatToDeep["depth"].setValue( 10.0 )
+
+		# Two single-sample images that don't overlap, leaving an empty tile
+		# between them
+
+		cropLeft = GafferImage.Crop()
+		cropLeft["in"].setInput( flatToDeep["out"] )
+		cropLeft["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 64 ) ) )
+		cropLeft["affectDisplayWindow"].setValue( False )
+
+		cropRight = GafferImage.Crop()
+		cropRight["in"].setInput( flatToDeep["out"] )
+		cropRight["area"].setValue( imath.Box2i( imath.V2i( 128, 0 ), imath.V2i( 192, 64 ) ) )
+		cropRight["affectDisplayWindow"].setValue( False )
+
+		merge = GafferImage.DeepMerge()
+		merge["in"][0].setInput( cropLeft["out"] )
+		merge["in"][1].setInput( cropRight["out"] )
+
+		flatten = GafferImage.DeepState()
+		flatten["in"].setInput( merge["out"] )
+		flatten["deepState"].setValue( GafferImage.DeepState.TargetState.Flat )
+
+		for channelName in [ "R", "G", "B", "A", "Z" ] :
+
+			# Tiles with a single sample per pixel can pass through the input data
+			self.assertTrue(
+				flatten["out"].channelData( channelName, imath.V2i( 0 ), _copy = False ).isSame(
+					merge["out"].channelData( channelName, imath.V2i( 0 ), _copy = False )
+				)
+			)
+			# Tiles without samples are black
+			self.assertTrue(
+				flatten["out"].channelData( channelName, imath.V2i( 64, 0 ), _copy = False ).isSame(
+					GafferImage.ImagePlug.blackTile( _copy = False )
+				)
+			)
+
+		# And the results should match the general purpose flattening, which
+		# we can force by adding a second sample to every pixel.
+
+		transparent = GafferImage.Constant()
+		transparent["format"].setValue( GafferImage.Format( 192, 64 ) )
+		transparent["color"].setValue( imath.Color4f( 0 ) )
+
+		transparentToDeep = GafferImage.FlatToDeep()
+		transparentToDeep["in"].setInput( transparent["out"] )
+		transparentToDeep["depth"].setValue( 20.0 )
+
+		generalMerge = GafferImage.DeepMerge()
+		generalMerge["in"][0].setInput( merge["out"] )
+		generalMerge["in"][1].setInput( transparentToDeep["out"] )
+
+		generalFlatten = GafferImage.DeepState()
+		generalFlatten["in"].setInput( generalMerge["out"] )
+		generalFlatten["deepState"].setValue( GafferImage.DeepState.TargetState.Flat )
+
+		for channelName in [ "R", "G", "B", "A" ] :
+			for tileOrigin in [ imath.V2i( 0 ), imath.V2i( 64, 0 ), imath.V2i( 128, 0 ) ] :
+				self.assertEqual(
+					flatten["out"].channelData( channelName, tileOrigin ),
+					generalFlatten["out"].channelData( channelName, tileOrigin )
+				)
+
 	def testMissingChannels( self ) :
 
 		# Create some messy data
@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import time
 import unittest
 import imath
 import itertools
@@ -239,6 +240,41 @@ class ImageAlgoTest( GafferImageTest.ImageTestCase ) :
 					if order != GafferImage.ImageAlgo.TileOrder.Unordered :
 						self.assertEqual( channelTileOrigins[i], tileOrigins[i] )
 
+	def testParallelGatherMaxPendingTiles( self ) :
+
+		c = GafferImage.Checkerboard()
+		c["format"].setValue( GafferImage.Format( 20 * GafferImage.ImagePlug.tileSize(), 10 * GafferImage.ImagePlug.tileSize() ) )
+
+		pending = set()
+		maxPending = [ 0 ]
+
+		def tileFunctor( image, tileOrigin ) :
+
+			pending.add( tileOrigin )
+			maxPending[0] = max( maxPending[0], len( pending ) )
+			if tileOrigin == imath.V2i( 0, 9 * GafferImage.ImagePlug.tileSize() ) :
+				# Slow tile, holding up the ordered gather.
+				time.sleep( 0.1 )
+			return tileOrigin
+
+		def gatherFunctor( image, tileOrigin, tile ) :
+
+			pending.remove( tileOrigin )
+
+		for maxPendingTiles in [ 1, 2, 5 ] :
+
+			maxPending[0] = 0
+			GafferImage.ImageAlgo.parallelGatherTiles(
+				c["out"],
+				tileFunctor,
+				gatherFunctor,
+				tileOrder = GafferImage.ImageAlgo.TileOrder.TopToBottom,
+				maxPendingTiles = maxPendingTiles
+			)
+
+			self.assertEqual( len( pending ), 0 )
+			self.assertLessEqual( maxPending[0], maxPendingTiles )
+
 	def testParallelGatherTileLifetime( self ) :
 
 		constant = GafferImage.Constant()
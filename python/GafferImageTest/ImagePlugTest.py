@@ -297,6 +297,53 @@ class ImagePlugTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
 
+	def testTileSampleLayout( self ) :
+
+		Layout = GafferImage.ImagePlug.TileSampleLayout
+		ts = GafferImage.ImagePlug.tileSize()
+
+		self.assertEqual( GafferImage.ImagePlug.tileSampleLayout( GafferImage.ImagePlug.emptyTileSampleOffsets( _copy = False ) ), Layout.Empty )
+		self.assertEqual( GafferImage.ImagePlug.tileSampleLayout( GafferImage.ImagePlug.flatTileSampleOffsets( _copy = False ) ), Layout.Flat )
+
+		# Copies must be classified by value rather than identity
+		self.assertEqual( GafferImage.ImagePlug.tileSampleLayout( GafferImage.ImagePlug.emptyTileSampleOffsets() ), Layout.Empty )
+		self.assertEqual( GafferImage.ImagePlug.tileSampleLayout( GafferImage.ImagePlug.flatTileSampleOffsets() ), Layout.Flat )
+
+		twoSamples = IECore.IntVectorData( range( 2, ts * ts * 2 + 1, 2 ) )
+		self.assertEqual( GafferImage.ImagePlug.tileSampleLayout( twoSamples ), Layout.General )
+
+		# One sample per pixel on average, but not on every pixel
+		unevenSamples = GafferImage.ImagePlug.flatTileSampleOffsets()
+		unevenSamples[0] = 0
+		unevenSamples[1] = 2
+		self.assertEqual( GafferImage.ImagePlug.tileSampleLayout( unevenSamples ), Layout.General )
+
+	def testComputedSampleOffsetsShareConstants( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 128, 128 ) )
+
+		flatToDeep = GafferImage.FlatToDeep()
+		flatToDeep["in"].setInput( constant["out"] )
+
+		# DeepMerge computes new offsets for a single input, but they are
+		# equivalent to the shared flat offsets, so should be substituted.
+		merge = GafferImage.DeepMerge()
+		merge["in"][0].setInput( flatToDeep["out"] )
+
+		self.assertTrue(
+			merge["out"].sampleOffsets( imath.V2i( 0 ), _copy = False ).isSame(
+				GafferImage.ImagePlug.flatTileSampleOffsets( _copy = False )
+			)
+		)
+
+		# And the same applies to tiles outside the data window.
+		self.assertTrue(
+			merge["out"].sampleOffsets( imath.V2i( 256 ), _copy = False ).isSame(
+				GafferImage.ImagePlug.emptyTileSampleOffsets( _copy = False )
+			)
+		)
+
 	def __testTileData( self, tileData, numSamples, value = None, valueFunc = None ) :
 
 		self.assertEqual( len(tileData), numSamples )
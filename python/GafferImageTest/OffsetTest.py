@@ -165,6 +165,12 @@ class OffsetTest( GafferImageTest.ImageTestCase ) :
 				o["out"].channelData( "R", offset ),
 				c["out"].channelData( "R", imath.V2i( 0 ) ),
 			)
+			# The upstream tile should be shared rather than copied.
+			self.assertTrue(
+				o["out"].channelData( "R", offset, _copy = False ).isSame(
+					c["out"].channelData( "R", imath.V2i( 0 ), _copy = False )
+				)
+			)
 
 	def testOffsetBack( self ) :
 
@@ -222,6 +228,26 @@ class OffsetTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( o["out"]["dataWindow"].getValue().isEmpty() )
 
+	def testTilesOutsideInputShareBlackTile( self ) :
+
+		c = GafferImage.Constant()
+		c["format"].setValue( GafferImage.Format( 100, 100 ) )
+
+		o = GafferImage.Offset()
+		o["in"].setInput( c["out"] )
+		o["offset"].setValue( imath.V2i( 10, 300 ) )
+
+		tileOrigin = imath.V2i( 0, 0 )
+		self.assertEqual(
+			o["out"].channelDataHash( "R", tileOrigin ),
+			GafferImage.ImagePlug.blackTile().hash()
+		)
+		self.assertTrue(
+			o["out"].channelData( "R", tileOrigin, _copy = False ).isSame(
+				GafferImage.ImagePlug.blackTile( _copy = False )
+			)
+		)
+
 
 if __name__ == "__main__":
 	unittest.main()
@@ -170,6 +170,47 @@ class VectorWarpTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( vectorWarp["out"], expectedReader["out"], maxDifference = 0.0005, ignoreMetadata = True )
 
+	def testLargeDisplacement( self ) :
+
+		# Build an ST map which mirrors the image horizontally, so that every
+		# output tile is sourced from a distant input tile.
+
+		dotGridReader = GafferImage.ImageReader()
+		dotGridReader["fileName"].setValue( self.imagesPath() / "dotGrid.300.exr" )
+
+		xRamp = GafferImage.Ramp()
+		xRamp["format"].setValue( GafferImage.Format( 300, 300 ) )
+		xRamp["endPosition"].setValue( imath.V2f( 300, 0 ) )
+		xRamp["ramp"]["p1"]["y"].setValue( imath.Color4f( 1, 0, 0, 1 ) )
+		yRamp = GafferImage.Ramp()
+		yRamp["format"].setValue( GafferImage.Format( 300, 300 ) )
+		yRamp["endPosition"].setValue( imath.V2f( 0, 300 ) )
+		yRamp["ramp"]["p1"]["y"].setValue( imath.Color4f( 0, 1, 0, 1 ) )
+
+		stMap = GafferImage.Merge()
+		stMap["operation"].setValue( GafferImage.Merge.Operation.Add )
+		stMap["in"]["in0"].setInput( xRamp["out"] )
+		stMap["in"]["in1"].setInput( yRamp["out"] )
+
+		mirroredSTMap = GafferImage.Mirror()
+		mirroredSTMap["in"].setInput( stMap["out"] )
+		mirroredSTMap["horizontal"].setValue( True )
+
+		vectorWarp = GafferImage.VectorWarp()
+		vectorWarp["in"].setInput( dotGridReader["out"] )
+		vectorWarp["vector"].setInput( mirroredSTMap["out"] )
+
+		mirroredImage = GafferImage.Mirror()
+		mirroredImage["in"].setInput( dotGridReader["out"] )
+		mirroredImage["horizontal"].setValue( True )
+
+		for filter in [ "box", "bilinear" ] :
+			for boundingMode in [ GafferImage.Sampler.BoundingMode.Black, GafferImage.Sampler.BoundingMode.Clamp ] :
+				with self.subTest( filter = filter, boundingMode = boundingMode ) :
+					vectorWarp["filter"].setValue( filter )
+					vectorWarp["boundingMode"].setValue( boundingMode )
+					self.assertImagesEqual( vectorWarp["out"], mirroredImage["out"], maxDifference = 0.00001, ignoreMetadata = True )
+
 	def runPerfTest( self, sourceRes, resultRes, filter, useDerivs ):
 		warpPatternReader = GafferImage.ImageReader()
 		warpPatternReader["fileName"].setValue( self.imagesPath() / "warpPattern.exr" )
@@ -230,5 +271,33 @@ class VectorWarpTest( GafferImageTest.ImageTestCase ) :
 	def testDownsamplePerf( self ):
 		self.runPerfTest( 6000, 300, "cubic", True )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testLargeDisplacementPerf( self ):
+
+		# Checkerboard ST map in relative pixel units, so that neighbouring
+		# output pixels are sourced from input tiles which are far apart.
+
+		vectors = GafferImage.Checkerboard()
+		vectors["format"].setValue( GafferImage.Format( 4096, 4096 ) )
+		vectors["size"].setValue( imath.V2f( 16 ) )
+		vectors["colorA"].setValue( imath.Color4f( 0, 0, 0, 1 ) )
+		vectors["colorB"].setValue( imath.Color4f( 1500, -1500, 0, 1 ) )
+
+		source = GafferImage.Checkerboard()
+		source["format"].setValue( GafferImage.Format( 4096, 4096 ) )
+
+		vectorWarp = GafferImage.VectorWarp()
+		vectorWarp["in"].setInput( source["out"] )
+		vectorWarp["vector"].setInput( vectors["out"] )
+		vectorWarp["vectorMode"].setValue( GafferImage.VectorWarp.VectorMode.Relative )
+		vectorWarp["vectorUnits"].setValue( GafferImage.VectorWarp.VectorUnits.Pixels )
+		vectorWarp["useDerivatives"].setValue( False )
+
+		GafferImageTest.processTiles( vectors["out"] )
+		GafferImageTest.processTiles( source["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( vectorWarp["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -114,6 +114,7 @@ from .OpenColorIOAlgoTest import OpenColorIOAlgoTest
 from .OpenColorIOContextTest import OpenColorIOContextTest
 from .OpenColorIOConfigPlugTest import OpenColorIOConfigPlugTest
 from .DeepSliceTest import DeepSliceTest
+from .ColorProcessorTest import ColorProcessorTest
 
 
 if __name__ == "__main__":
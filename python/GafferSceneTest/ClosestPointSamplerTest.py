@@ -263,6 +263,71 @@ class ClosestPointSamplerTest( GafferSceneTest.SceneTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope() :
 			sampler["out"].object( "/plane" )
 
+	def testManyQueries( self ) :
+
+		# Enough queries to use a spatial sampling order.
+		# Results should still be delivered to the right
+		# indices.
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 100 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		points = GafferScene.MeshToPoints()
+		points["in"].setInput( plane["out"] )
+		points["filter"].setInput( planeFilter["out"] )
+
+		sampler = GafferScene.ClosestPointSampler()
+		sampler["in"].setInput( plane["out"] )
+		sampler["source"].setInput( points["out"] )
+		sampler["filter"].setInput( planeFilter["out"] )
+		sampler["sourceLocation"].setValue( "/plane" )
+		sampler["primitiveVariables"].setValue( "P" )
+		sampler["prefix"].setValue( "sampled:" )
+
+		inMesh = sampler["in"].object( "/plane" )
+		outMesh = sampler["out"].object( "/plane" )
+		self.assertGreater( inMesh["P"].data.size(), 1024 )
+		self.assertEqual( outMesh["sampled:P"], inMesh["P"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSharedSourcePerformance( self ) :
+
+		# Many destination locations sampling from the same
+		# large source, which should share a single evaluator.
+
+		source = GafferScene.Plane()
+		source["divisions"].setValue( imath.V2i( 1000 ) )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 10 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["filter"].setInput( planeFilter["out"] )
+		duplicate["copies"].setValue( 1000 )
+
+		allFilter = GafferScene.PathFilter()
+		allFilter["paths"].setValue( IECore.StringVectorData( [ "/*" ] ) )
+
+		sampler = GafferScene.ClosestPointSampler()
+		sampler["in"].setInput( duplicate["out"] )
+		sampler["source"].setInput( source["out"] )
+		sampler["filter"].setInput( allFilter["out"] )
+		sampler["sourceLocation"].setValue( "/plane" )
+		sampler["primitiveVariables"].setValue( "uv" )
+
+		GafferSceneTest.traverseScene( sampler["in"] )
+		sampler["source"].object( "/plane" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.traverseScene( sampler["out"] )
+
 	def testPruneSourceLocation( self ) :
 
 		plane = GafferScene.Plane()
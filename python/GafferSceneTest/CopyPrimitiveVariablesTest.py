@@ -35,6 +35,7 @@
 ##########################################################################
 
 import unittest
+import imath
 
 import IECore
 import IECoreScene
@@ -334,5 +335,29 @@ class CopyPrimitiveVariablesTest( GafferSceneTest.SceneTestCase ) :
 		cubeVariables["enabled"].setValue( True )
 		self.assertEqual( copy["out"].object( "/sphere" )["c"], IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Constant, IECore.IntData( 1 ) )  )
 
+	def testSharesData( self ) :
+
+		plane = GafferScene.Plane()
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sourcePlane = GafferScene.Plane()
+		sourcePlane["dimensions"].setValue( imath.V2f( 2 ) )
+
+		copy = GafferScene.CopyPrimitiveVariables()
+		copy["in"].setInput( plane["out"] )
+		copy["source"].setInput( sourcePlane["out"] )
+		copy["filter"].setInput( planeFilter["out"] )
+		copy["primitiveVariables"].setValue( "P" )
+		copy["prefix"].setValue( "source:" )
+
+		inObject = plane["out"].object( "/plane", _copy = False )
+		sourceObject = sourcePlane["out"].object( "/plane", _copy = False )
+		outObject = copy["out"].object( "/plane", _copy = False )
+
+		self.assertTrue( outObject["source:P"].data.isSame( sourceObject["P"].data ) )
+		for name in inObject.keys() :
+			self.assertTrue( outObject[name].data.isSame( inObject[name].data ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -93,5 +93,18 @@ class DeletePrimitiveVariablesTest( GafferSceneTest.SceneTestCase ) :
 		d["names"].setValue( "*" )
 		self.assertEqual( d["out"].object( "/plane" ).keys(), [] )
 
+	def testSharesUnmodifiedData( self ) :
+
+		plane = GafferScene.Plane()
+		deletePrimitiveVariables = GafferScene.DeletePrimitiveVariables()
+		deletePrimitiveVariables["in"].setInput( plane["out"] )
+		deletePrimitiveVariables["names"].setValue( "N" )
+
+		inObject = plane["out"].object( "/plane", _copy = False )
+		outObject = deletePrimitiveVariables["out"].object( "/plane", _copy = False )
+		self.assertNotIn( "N", outObject )
+		self.assertTrue( outObject["P"].data.isSame( inObject["P"].data ) )
+		self.assertTrue( outObject["uv"].data.isSame( inObject["uv"].data ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -245,5 +245,73 @@ class RendererTest( GafferTest.TestCase ) :
 
 		renderer.render()
 
+	def testBackgroundConversion( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"OpenGL",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		renderer.option( "gl:backgroundConversionThreshold", IECore.IntData( 1 ) )
+
+		plane = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ), divisions = imath.V2i( 100 )
+		)
+
+		o = renderer.object(
+			"/plane",
+			plane,
+			renderer.attributes( IECore.CompoundObject() )
+		)
+		o.transform( imath.M44f().translate( imath.V3f( 1 ) ) )
+
+		# The bound is available immediately, whether or not
+		# the conversion has completed.
+
+		expectedBound = imath.Box3f( plane.bound().min() + imath.V3f( 1 ), plane.bound().max() + imath.V3f( 1 ) )
+		self.assertEqual( renderer.command( "gl:queryBound", {} ), expectedBound )
+
+		self.assertEqual( renderer.command( "gl:waitForConversions", {} ), IECore.BoolData( True ) )
+		self.assertEqual( renderer.command( "gl:queryBound", {} ), expectedBound )
+
+		# A timeout may be given, with the result reporting whether or
+		# not all conversions completed.
+
+		self.assertEqual(
+			renderer.command( "gl:waitForConversions", { "timeout" : IECore.FloatData( 0 ) } ),
+			IECore.BoolData( True )
+		)
+
+		# Objects may be deleted before their conversion is complete.
+
+		del o
+		o = renderer.object( "/plane", plane, renderer.attributes( IECore.CompoundObject() ) )
+		del o
+		renderer.command( "gl:waitForConversions", {} )
+		self.assertEqual( renderer.command( "gl:queryBound", {} ), imath.Box3f() )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testBackgroundConversionPerformance( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"OpenGL",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Interactive
+		)
+		attributes = renderer.attributes( IECore.CompoundObject() )
+
+		# Distinct meshes, so that they can't be shared via the
+		# converter's cache.
+		meshes = [
+			IECoreScene.MeshPrimitive.createPlane(
+				imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 + i ) ), divisions = imath.V2i( 400 )
+			)
+			for i in range( 0, 20 )
+		]
+
+		objects = []
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i, mesh in enumerate( meshes ) :
+				objects.append( renderer.object( "/plane{}".format( i ), mesh, attributes ) )
+			renderer.command( "gl:waitForConversions", {} )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,120 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+
+import IECore
+import IECoreScene
+
+import GafferTest
+import GafferScene
+
+class AttributesCacheTest( GafferTest.TestCase ) :
+
+	def testIdenticalAttributesAreShared( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		cache = GafferScene.Private.IECoreScenePreview.AttributesCache( renderer )
+
+		a1 = cache.get( IECore.CompoundObject( { "x" : IECore.IntData( 1 ) } ) )
+		a2 = cache.get( IECore.CompoundObject( { "x" : IECore.IntData( 1 ) } ) )
+		a3 = cache.get( IECore.CompoundObject( { "x" : IECore.IntData( 2 ) } ) )
+
+		self.assertTrue( a1.isSame( a2 ) )
+		self.assertFalse( a1.isSame( a3 ) )
+		self.assertEqual( a1.attributes(), IECore.CompoundObject( { "x" : IECore.IntData( 1 ) } ) )
+		self.assertEqual( a3.attributes(), IECore.CompoundObject( { "x" : IECore.IntData( 2 ) } ) )
+
+		self.assertEqual( renderer.statistics().attributes, 2 )
+		self.assertEqual( cache.statistics().attributesHits, 1 )
+		self.assertEqual( cache.statistics().attributesMisses, 2 )
+
+	def testShadersAreInterned( self ) :
+
+		def shaderNetwork() :
+
+			return IECoreScene.ShaderNetwork(
+				shaders = {
+					"output" : IECoreScene.Shader( "test" ),
+				},
+				output = "output"
+			)
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		cache = GafferScene.Private.IECoreScenePreview.AttributesCache( renderer )
+
+		a1 = cache.get( IECore.CompoundObject( { "surface" : shaderNetwork(), "x" : IECore.IntData( 1 ) } ) )
+		a2 = cache.get( IECore.CompoundObject( { "surface" : shaderNetwork(), "x" : IECore.IntData( 2 ) } ) )
+
+		self.assertFalse( a1.isSame( a2 ) )
+		self.assertEqual( a1.attributes()["surface"], shaderNetwork() )
+		self.assertEqual( a2.attributes()["surface"], shaderNetwork() )
+		self.assertEqual( a2.attributes()["x"], IECore.IntData( 2 ) )
+		self.assertTrue( a1.attributes()["surface"].isSame( a2.attributes()["surface"] ) )
+
+		self.assertEqual( cache.statistics().shaderMisses, 1 )
+		self.assertEqual( cache.statistics().shaderHits, 1 )
+
+	def testClearUnused( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		cache = GafferScene.Private.IECoreScenePreview.AttributesCache( renderer )
+
+		a1 = cache.get( IECore.CompoundObject( { "x" : IECore.IntData( 1 ) } ) )
+		a2 = cache.get( IECore.CompoundObject( { "x" : IECore.IntData( 2 ) } ) )
+		del a2
+
+		cache.clearUnused()
+
+		# `a1` is still in use, so is reused.
+		self.assertTrue( a1.isSame( cache.get( IECore.CompoundObject( { "x" : IECore.IntData( 1 ) } ) ) ) )
+		self.assertEqual( renderer.statistics().attributes, 2 )
+
+		# But `a2` was cleared, so must be recreated.
+		cache.get( IECore.CompoundObject( { "x" : IECore.IntData( 2 ) } ) )
+		self.assertEqual( renderer.statistics().attributes, 3 )
+
+	def testCacheKeepsRendererAlive( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		cache = GafferScene.Private.IECoreScenePreview.AttributesCache( renderer )
+		del renderer
+
+		attributes = cache.get( IECore.CompoundObject() )
+		self.assertIsInstance( attributes, GafferScene.Private.IECoreScenePreview.CapturingRenderer.CapturedAttributes )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -168,6 +168,141 @@ class CapturingRendererTest( GafferTest.TestCase ) :
 		self.assertEqual( c.capturedSamples(), [ sphere1, sphere2 ] )
 		self.assertEqual( c.capturedSampleTimes(), [ 1, 2 ] )
 
+	def testInstances( self ) :
+
+		sphere = IECoreScene.SpherePrimitive()
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		attributes = renderer.attributes( IECore.CompoundObject( { "a" : IECore.IntData( 1 ) } ) )
+		self.assertEqual( renderer.numInstanceBatches(), 0 )
+
+		# Static transforms
+
+		renderer.instances(
+			[ "a", "b" ], [ sphere ], [],
+			[ imath.M44f().translate( imath.V3f( x, 0, 0 ) ) for x in range( 0, 2 ) ], [],
+			attributes
+		)
+		self.assertEqual( renderer.numInstanceBatches(), 1 )
+
+		for i, name in enumerate( [ "a", "b" ] ) :
+			c = renderer.capturedObject( name )
+			self.assertEqual( c.capturedSamples(), [ sphere ] )
+			self.assertEqual( c.capturedSampleTimes(), [] )
+			self.assertEqual( c.capturedTransforms(), [ imath.M44f().translate( imath.V3f( i, 0, 0 ) ) ] )
+			self.assertEqual( c.capturedTransformTimes(), [] )
+			self.assertEqual( c.capturedAttributes().attributes(), IECore.CompoundObject( { "a" : IECore.IntData( 1 ) } ) )
+
+		# Animated transforms, stored with all the samples for
+		# each instance next to each other.
+
+		renderer.instances(
+			[ "c", "d" ], [ sphere ], [],
+			[ imath.M44f().translate( imath.V3f( 0, y, 0 ) ) for y in range( 0, 4 ) ], [ 0, 1 ],
+			attributes
+		)
+		self.assertEqual( renderer.numInstanceBatches(), 2 )
+
+		self.assertEqual(
+			renderer.capturedObject( "c" ).capturedTransforms(),
+			[ imath.M44f().translate( imath.V3f( 0, y, 0 ) ) for y in ( 0, 1 ) ]
+		)
+		self.assertEqual(
+			renderer.capturedObject( "d" ).capturedTransforms(),
+			[ imath.M44f().translate( imath.V3f( 0, y, 0 ) ) for y in ( 2, 3 ) ]
+		)
+		self.assertEqual( renderer.capturedObject( "d" ).capturedTransformTimes(), [ 0, 1 ] )
+
+		# Mismatched transforms
+
+		with self.assertRaisesRegex( RuntimeError, "Wrong number of transforms" ) :
+			renderer.instances( [ "e", "f" ], [ sphere ], [], [ imath.M44f() ], [], attributes )
+
+		self.assertIsNone( renderer.capturedObject( "e" ) )
+
+	def testHashOnly( self ) :
+
+		sphere1 = IECoreScene.SpherePrimitive( 1 )
+		sphere2 = IECoreScene.SpherePrimitive( 2 )
+		coreAttributes = IECore.CompoundObject( { "x" : IECore.IntData( 10 ) } )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		attributes = renderer.attributes( coreAttributes )
+		o = renderer.object( "o", [ sphere1, sphere2 ], [ 1, 2 ], attributes )
+
+		hashOnlyRenderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		hashOnlyRenderer.option( "cr:hashOnly", IECore.BoolData( True ) )
+		hashOnlyAttributes = hashOnlyRenderer.attributes( coreAttributes )
+		hashOnlyObject = hashOnlyRenderer.object( "o", [ sphere1, sphere2 ], [ 1, 2 ], hashOnlyAttributes )
+
+		# Hash-only capture doesn't retain the objects or attributes,
+		# but the hashes match those from a full capture.
+
+		self.assertIsNone( hashOnlyAttributes.attributes() )
+		self.assertEqual( hashOnlyAttributes.hash(), coreAttributes.hash() )
+		self.assertEqual( hashOnlyAttributes.hash(), attributes.hash() )
+
+		self.assertEqual( hashOnlyObject.capturedSamples(), [] )
+		self.assertEqual( hashOnlyObject.capturedSampleTimes(), [ 1, 2 ] )
+		self.assertEqual( hashOnlyObject.capturedSamplesHash(), o.capturedSamplesHash() )
+
+		hashOnlyObject2 = hashOnlyRenderer.object( "o2", [ sphere1, sphere1 ], [ 1, 2 ], hashOnlyAttributes )
+		self.assertNotEqual( hashOnlyObject2.capturedSamplesHash(), hashOnlyObject.capturedSamplesHash() )
+
+		# Special attributes are still respected.
+
+		unrenderableAttributes = hashOnlyRenderer.attributes( IECore.CompoundObject( { "cr:unrenderable" : IECore.BoolData( True ) } ) )
+		self.assertIsNone( hashOnlyRenderer.object( "u", sphere1, unrenderableAttributes ) )
+
+	def testHashOnlyNullSamples( self ) :
+
+		# Lights and light filters without objects are output
+		# with null samples.
+
+		for hashOnly in ( False, True ) :
+
+			renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+			renderer.option( "cr:hashOnly", IECore.BoolData( hashOnly ) )
+			attributes = renderer.attributes( IECore.CompoundObject() )
+
+			light = renderer.light( "l", None, attributes )
+			lightFilter = renderer.lightFilter( "f", None, attributes )
+			self.assertEqual( light.capturedSamplesHash(), lightFilter.capturedSamplesHash() )
+
+			light2 = renderer.light( "l2", IECoreScene.SpherePrimitive(), attributes )
+			self.assertNotEqual( light2.capturedSamplesHash(), light.capturedSamplesHash() )
+
+	def testStatistics( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		statistics = renderer.statistics()
+		for name in [ "attributes", "cameras", "lights", "lightFilters", "objects", "transformEdits", "attributeEdits", "linkEdits" ] :
+			self.assertEqual( getattr( statistics, name ), 0 )
+
+		attributes1 = renderer.attributes( IECore.CompoundObject() )
+		attributes2 = renderer.attributes( IECore.CompoundObject( { "x" : IECore.IntData( 1 ) } ) )
+
+		o = renderer.object( "o", IECoreScene.SpherePrimitive(), attributes1 )
+		c = renderer.camera( "c", IECoreScene.Camera(), attributes1 )
+		l = renderer.light( "l", IECore.NullObject(), attributes1 )
+		lf = renderer.lightFilter( "lf", IECore.NullObject(), attributes1 )
+
+		o.transform( imath.M44f() )
+		o.transform( [ imath.M44f(), imath.M44f() ], [ 0, 1 ] )
+		o.attributes( attributes2 )
+		o.link( "lights", { l } )
+
+		statistics = renderer.statistics()
+		self.assertEqual( statistics.attributes, 2 )
+		self.assertEqual( statistics.cameras, 1 )
+		self.assertEqual( statistics.lights, 1 )
+		self.assertEqual( statistics.lightFilters, 1 )
+		self.assertEqual( statistics.objects, 1 )
+		self.assertEqual( statistics.transformEdits, 2 )
+		self.assertEqual( statistics.attributeEdits, 1 )
+		self.assertEqual( statistics.linkEdits, 1 )
+
 	class TestProcedural( GafferScene.Private.IECoreScenePreview.Procedural ) :
 
 		def __init__( self ) :
@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+from .AttributesCacheTest import AttributesCacheTest
 from .CapturingRendererTest import CapturingRendererTest
 from .CompoundRendererTest import CompoundRendererTest
 from .PlaceholderTest import PlaceholderTest
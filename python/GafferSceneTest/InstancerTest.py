@@ -2811,6 +2811,59 @@ parent["radius"] = ( 2 + context.getFrame() ) * 15
 
 		self.assertEqual( instancer["variations"].getValue(), IECore.CompoundData( { "" : IECore.IntData( 0 ) } ) )
 
+	def testEncapsulatedInstancesAreBatched( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 20 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+		instancer["encapsulateInstanceGroups"].setValue( True )
+
+		capsule = instancer["out"].object( "/plane/instances/sphere" )
+		self.assertIsInstance( capsule, GafferScene.Capsule )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		capsule.render( renderer )
+
+		# Instances sharing a prototype are output in batches, rather than
+		# one at a time.
+
+		numPoints = plane["out"].object( "/plane" )["P"].data.size()
+		self.assertEqual( len( renderer.capturedObjectNames() ), numPoints )
+		self.assertGreater( renderer.numInstanceBatches(), 0 )
+		self.assertLess( renderer.numInstanceBatches(), numPoints )
+
+		# But they are still captured exactly as if they had been output
+		# individually.
+
+		instancer["encapsulateInstanceGroups"].setValue( False )
+		self.assertEncapsulatedRendersSame( instancer )
+		instancer["encapsulateInstanceGroups"].setValue( True )
+
+		# Per-instance attributes require unique renderer attributes for
+		# every instance, so can't be batched.
+
+		instancer["attributes"].setValue( "N" )
+		capsule = instancer["out"].object( "/plane/instances/sphere" )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		capsule.render( renderer )
+
+		self.assertEqual( len( renderer.capturedObjectNames() ), numPoints )
+		self.assertEqual( renderer.numInstanceBatches(), 0 )
+
 	def testPrototypePropertiesAffectCapsule( self ) :
 
 		plane = GafferScene.Plane()
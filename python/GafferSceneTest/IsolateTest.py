@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import inspect
 import unittest
 
 import IECore
@@ -488,5 +489,43 @@ class IsolateTest( GafferSceneTest.SceneTestCase ) :
 		self.assertSceneValid( isolate["out"] )
 		self.assertTrue( isolate["out"].exists( "/sphere" ) )
 
+	def testAnimatedSet( self ) :
+
+		# Membership of the input set changes from frame to frame,
+		# while the filter stays the same.
+
+		script = Gaffer.ScriptNode()
+
+		script["setNode"] = GafferScene.Set()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( inspect.cleandoc(
+			"""
+			import IECore
+			frame = int( context.getFrame() )
+			parent["setNode"]["paths"] = IECore.StringVectorData(
+				[ "/a/b{}".format( i ) for i in range( 0, 100 ) if ( i + frame ) % 7 ] +
+				[ "/c/d{}".format( i ) for i in range( frame, frame + 5 ) ]
+			)
+			"""
+		) )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/a/b1*", "/c/d3" ] ) )
+
+		script["isolate"] = GafferScene.Isolate()
+		script["isolate"]["in"].setInput( script["setNode"]["out"] )
+		script["isolate"]["filter"].setInput( script["filter"]["out"] )
+
+		filterMatcher = IECore.PathMatcher( [ "/a/b1*", "/c/d3" ] )
+		with Gaffer.Context() as context :
+			for frame in list( range( 1, 20 ) ) + list( range( 20, 0, -3 ) ) :
+				context.setFrame( frame )
+				inputSet = script["isolate"]["in"].set( "set" ).value
+				expectedSet = IECore.PathMatcher( [
+					p for p in inputSet.paths()
+					if filterMatcher.match( p ) & ( IECore.PathMatcher.Result.ExactMatch | IECore.PathMatcher.Result.AncestorMatch )
+				] )
+				self.assertEqual( script["isolate"]["out"].set( "set" ).value, expectedSet )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -40,6 +40,7 @@ import imath
 import IECore
 import IECoreScene
 
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -100,5 +101,57 @@ class MeshDistortionTest( GafferSceneTest.SceneTestCase ) :
 		self.assertNotIn( "uvDistortion", mesh )
 		self.assertIn( "D", mesh )
 
+	def __stretchedSphere( self, divisions ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( divisions )
+
+		mesh = sphere["out"].object( "/sphere" ).copy()
+		mesh["Pref"] = mesh["P"]
+		mesh["P"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ p * imath.V3f( 2, 1, 1 ) for p in mesh["P"].data ] )
+		)
+
+		return mesh
+
+	def testLargeMesh( self ) :
+
+		inputMesh = self.__stretchedSphere( imath.V2i( 400, 400 ) )
+		self.assertGreater( inputMesh.numFaces(), 100000 )
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( inputMesh )
+
+		f = GafferScene.PathFilter()
+		f["paths"].setValue( IECore.StringVectorData( [ "/object" ] ) )
+
+		meshDistortion = GafferScene.MeshDistortion()
+		meshDistortion["in"].setInput( objectToScene["out"] )
+		meshDistortion["filter"].setInput( f["out"] )
+
+		mesh = meshDistortion["out"].object( "/object" )
+		distortion, uvDistortion = IECoreScene.MeshAlgo.calculateDistortion( inputMesh, "uv", "Pref", "P" )
+		self.assertEqual( mesh["distortion"], distortion )
+		self.assertEqual( mesh["uvDistortion"], uvDistortion )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( self.__stretchedSphere( imath.V2i( 1000, 1000 ) ) )
+
+		f = GafferScene.PathFilter()
+		f["paths"].setValue( IECore.StringVectorData( [ "/object" ] ) )
+
+		meshDistortion = GafferScene.MeshDistortion()
+		meshDistortion["in"].setInput( objectToScene["out"] )
+		meshDistortion["filter"].setInput( f["out"] )
+
+		meshDistortion["in"].object( "/object" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			meshDistortion["out"].object( "/object" )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -119,5 +119,64 @@ class MeshNormalsTest( GafferSceneTest.SceneTestCase ) :
 				sortedVec.equalWithRelError( imath.V3f( 1, 2, 2 ).normalized(), 1e-7 )
 			)
 
+	def testLargeMesh( self ) :
+
+		# Large enough to be processed in parallel, and with triangles at the
+		# poles and varying face sizes.
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 400, 400 ) )
+
+		sphereFilter = GafferScene.PathFilter()
+		sphereFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		meshNormals = GafferScene.MeshNormals()
+		meshNormals["in"].setInput( sphere["out"] )
+		meshNormals["filter"].setInput( sphereFilter["out"] )
+
+		inputMesh = sphere["out"].object( "/sphere" )
+		self.assertGreater( inputMesh.numFaces(), 100000 )
+
+		for weighting in IECoreScene.MeshAlgo.NormalWeighting.values.values() :
+
+			meshNormals["weighting"].setValue( weighting )
+
+			meshNormals["interpolation"].setValue( IECoreScene.PrimitiveVariable.Interpolation.Uniform )
+			self.assertEqual(
+				meshNormals["out"].object( "/sphere" )["N"],
+				IECoreScene.MeshAlgo.calculateUniformNormals( inputMesh )
+			)
+
+			meshNormals["interpolation"].setValue( IECoreScene.PrimitiveVariable.Interpolation.Vertex )
+			self.assertEqual(
+				meshNormals["out"].object( "/sphere" )["N"],
+				IECoreScene.MeshAlgo.calculateVertexNormals( inputMesh, weighting )
+			)
+
+			meshNormals["interpolation"].setValue( IECoreScene.PrimitiveVariable.Interpolation.FaceVarying )
+			self.assertEqual(
+				meshNormals["out"].object( "/sphere" )["N"],
+				IECoreScene.MeshAlgo.calculateFaceVaryingNormals( inputMesh, weighting, 40 )
+			)
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 1000, 1000 ) )
+
+		sphereFilter = GafferScene.PathFilter()
+		sphereFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		meshNormals = GafferScene.MeshNormals()
+		meshNormals["in"].setInput( sphere["out"] )
+		meshNormals["filter"].setInput( sphereFilter["out"] )
+		meshNormals["interpolation"].setValue( IECoreScene.PrimitiveVariable.Interpolation.FaceVarying )
+
+		meshNormals["in"].object( "/sphere" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			meshNormals["out"].object( "/sphere" )
+
 if __name__ == "__main__":
 	unittest.main()
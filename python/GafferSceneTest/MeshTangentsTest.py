@@ -42,6 +42,7 @@ import IECore
 import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -348,3 +349,57 @@ class MeshTangentsTest( GafferSceneTest.SceneTestCase ) :
 		object = meshTangents['out'].object( "/object" )
 		for u, v, n in zip( object['tangent'].data, object['biTangent'].data, object['N'].data ) :
 			self.assertFalse( isLeftHanded( u, v, n ) )
+
+	def testLargeMesh( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 400, 400 ) )
+
+		sphereFilter = GafferScene.PathFilter()
+		sphereFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		meshTangents = GafferScene.MeshTangents()
+		meshTangents["in"].setInput( sphere["out"] )
+		meshTangents["filter"].setInput( sphereFilter["out"] )
+
+		inputMesh = sphere["out"].object( "/sphere" )
+		self.assertGreater( inputMesh.numFaces(), 100000 )
+
+		for leftHanded in ( False, True ) :
+
+			meshTangents["leftHanded"].setValue( leftHanded )
+
+			meshTangents["mode"].setValue( GafferScene.MeshTangents.Mode.UV )
+			mesh = meshTangents["out"].object( "/sphere" )
+			uTangent, vTangent = IECoreScene.MeshAlgo.calculateTangentsFromUV( inputMesh, "uv", "P", True, leftHanded )
+			self.assertEqual( mesh["uTangent"], uTangent )
+			self.assertEqual( mesh["vTangent"], vTangent )
+
+			for mode, function in [
+				( GafferScene.MeshTangents.Mode.FirstEdge, IECoreScene.MeshAlgo.calculateTangentsFromFirstEdge ),
+				( GafferScene.MeshTangents.Mode.TwoEdges, IECoreScene.MeshAlgo.calculateTangentsFromTwoEdges ),
+				( GafferScene.MeshTangents.Mode.PrimitiveCentroid, IECoreScene.MeshAlgo.calculateTangentsFromPrimitiveCentroid ),
+			] :
+				meshTangents["mode"].setValue( mode )
+				mesh = meshTangents["out"].object( "/sphere" )
+				tangent, biTangent = function( inputMesh, "P", "N", True, leftHanded )
+				self.assertEqual( mesh["tangent"], tangent )
+				self.assertEqual( mesh["biTangent"], biTangent )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 1000, 1000 ) )
+
+		sphereFilter = GafferScene.PathFilter()
+		sphereFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		meshTangents = GafferScene.MeshTangents()
+		meshTangents["in"].setInput( sphere["out"] )
+		meshTangents["filter"].setInput( sphereFilter["out"] )
+
+		meshTangents["in"].object( "/sphere" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			meshTangents["out"].object( "/sphere" )
@@ -108,5 +108,19 @@ class PrimitiveVariablesTest( GafferSceneTest.SceneTestCase ) :
 		self.assertEqual( o["mySecondData"].data.getInterpretation(), IECore.GeometricData.Interpretation.Vector )
 		self.assertEqual( o["myThirdData"].data.getInterpretation(), IECore.GeometricData.Interpretation.Normal )
 
+	def testSharesUnmodifiedData( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		primitiveVariables = GafferScene.PrimitiveVariables()
+		primitiveVariables["in"].setInput( sphere["out"] )
+		primitiveVariables["primitiveVariables"].addChild( Gaffer.NameValuePlug( "test", IECore.IntData( 10 ) ) )
+
+		inObject = sphere["out"].object( "/sphere", _copy = False )
+		outObject = primitiveVariables["out"].object( "/sphere", _copy = False )
+		self.assertIn( "test", outObject )
+		for name in inObject.keys() :
+			self.assertTrue( outObject[name].data.isSame( inObject[name].data ) )
+
 if __name__ == "__main__":
 	unittest.main()
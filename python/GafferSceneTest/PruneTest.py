@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import inspect
 import unittest
 import imath
 
@@ -361,6 +362,44 @@ class PruneTest( GafferSceneTest.SceneTestCase ) :
 					else :
 						self.assertTrue( inputSetPath in outputSet )
 
+	def testAnimatedSet( self ) :
+
+		# Membership of the input set changes from frame to frame,
+		# while the filter stays the same.
+
+		script = Gaffer.ScriptNode()
+
+		script["setNode"] = GafferScene.Set()
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( inspect.cleandoc(
+			"""
+			import IECore
+			frame = int( context.getFrame() )
+			parent["setNode"]["paths"] = IECore.StringVectorData(
+				[ "/a/b{}".format( i ) for i in range( 0, 100 ) if ( i + frame ) % 7 ] +
+				[ "/c/d{}".format( i ) for i in range( frame, frame + 5 ) ]
+			)
+			"""
+		) )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/a/b1*", "/c/d3" ] ) )
+
+		script["prune"] = GafferScene.Prune()
+		script["prune"]["in"].setInput( script["setNode"]["out"] )
+		script["prune"]["filter"].setInput( script["filter"]["out"] )
+
+		filterMatcher = IECore.PathMatcher( [ "/a/b1*", "/c/d3" ] )
+		with Gaffer.Context() as context :
+			for frame in list( range( 1, 20 ) ) + list( range( 20, 0, -3 ) ) :
+				context.setFrame( frame )
+				inputSet = script["prune"]["in"].set( "set" ).value
+				expectedSet = IECore.PathMatcher( [
+					p for p in inputSet.paths()
+					if not filterMatcher.match( p ) & ( IECore.PathMatcher.Result.ExactMatch | IECore.PathMatcher.Result.AncestorMatch )
+				] )
+				self.assertEqual( script["prune"]["out"].set( "set" ).value, expectedSet )
+
 	def testNameChangeUpdatesBounds( self ) :
 
 		plane = GafferScene.Plane()
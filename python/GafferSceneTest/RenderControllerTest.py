@@ -271,6 +271,168 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 
 		del capturedSphere, capturedLightA, capturedLightB
 
+	def testUnusedLightLinksDontKeepLightsAlive( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( sphere["out"] )
+		attributes["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributes["attributes"]["linkedLights"]["value"].setValue( "A" )
+
+		lightA = GafferSceneTest.TestLight()
+		lightA["name"].setValue( "lightA" )
+		lightA["sets"].setValue( "A" )
+
+		lightB = GafferSceneTest.TestLight()
+		lightB["name"].setValue( "lightB" )
+		lightB["sets"].setValue( "B" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( attributes["out"] )
+		group["in"][1].setInput( lightA["out"] )
+		group["in"][2].setInput( lightB["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( group["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		self.assertEqual(
+			renderer.capturedObject( "/group/sphere" ).capturedLinks( "lights" ),
+			{ renderer.capturedObject( "/group/lightA" ) }
+		)
+
+		# Stop using the expression that linked to `lightA`.
+
+		attributes["attributes"]["linkedLights"]["value"].setValue( "B" )
+		controller.update()
+		self.assertEqual(
+			renderer.capturedObject( "/group/sphere" ).capturedLinks( "lights" ),
+			{ renderer.capturedObject( "/group/lightB" ) }
+		)
+
+		# Deleting `lightA` should remove it from the renderer, rather than
+		# it being kept alive by the links for the unused expression.
+
+		group["in"][1].setInput( None )
+		controller.update()
+		self.assertIsNone( renderer.capturedObject( "/group/lightA" ) )
+		self.assertIsNotNone( renderer.capturedObject( "/group/lightB" ) )
+
+	def testSetEditsOnlyRelinkWhenLinksChange( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 2 )
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( duplicate["out"] )
+		attributes["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributes["attributes"]["linkedLights"]["value"].setValue( "A" )
+
+		lightA = GafferSceneTest.TestLight()
+		lightA["name"].setValue( "lightA" )
+		lightA["sets"].setValue( "A" )
+
+		lightB = GafferSceneTest.TestLight()
+		lightB["name"].setValue( "lightB" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( attributes["out"] )
+		group["in"][1].setInput( lightA["out"] )
+		group["in"][2].setInput( lightB["out"] )
+
+		setFilter = GafferScene.PathFilter()
+
+		setNode = GafferScene.Set()
+		setNode["in"].setInput( group["out"] )
+		setNode["filter"].setInput( setFilter["out"] )
+		setNode["mode"].setValue( GafferScene.Set.Mode.Add )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( setNode["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		names = [ "/group/sphere", "/group/sphere1", "/group/sphere2" ]
+		capturedLightA = renderer.capturedObject( "/group/lightA" )
+		capturedLightB = renderer.capturedObject( "/group/lightB" )
+
+		def assertLinks( lights, numLinkEdits ) :
+
+			for name in names :
+				self.assertEqual( renderer.capturedObject( name ).capturedLinks( "lights" ), lights )
+				self.assertEqual( renderer.capturedObject( name ).numLinkEdits( "lights" ), numLinkEdits )
+
+		assertLinks( { capturedLightA }, 1 )
+
+		# Editing a set which isn't referenced by the linking expression
+		# shouldn't cause any relinking.
+
+		setNode["name"].setValue( "C" )
+		setFilter["paths"].setValue( IECore.StringVectorData( [ "/group/lightB" ] ) )
+		controller.update()
+		assertLinks( { capturedLightA }, 1 )
+
+		# Nor should editing a referenced set in a way that doesn't
+		# affect which lights are linked.
+
+		setNode["name"].setValue( "A" )
+		setFilter["paths"].setValue( IECore.StringVectorData( [ "/group/sphere" ] ) )
+		controller.update()
+		assertLinks( { capturedLightA }, 1 )
+
+		# But adding a light to the set should.
+
+		setFilter["paths"].setValue( IECore.StringVectorData( [ "/group/lightB" ] ) )
+		controller.update()
+		assertLinks( { capturedLightA, capturedLightB }, 2 )
+
+		del capturedLightA, capturedLightB
+
+	def testReplacedObjectsAreLinked( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( sphere["out"] )
+		attributes["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributes["attributes"]["linkedLights"]["value"].setValue( "A" )
+
+		lightA = GafferSceneTest.TestLight()
+		lightA["name"].setValue( "lightA" )
+		lightA["sets"].setValue( "A" )
+
+		lightB = GafferSceneTest.TestLight()
+		lightB["name"].setValue( "lightB" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( attributes["out"] )
+		group["in"][1].setInput( lightA["out"] )
+		group["in"][2].setInput( lightB["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( group["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		capturedLightA = renderer.capturedObject( "/group/lightA" )
+		self.assertEqual( renderer.capturedObject( "/group/sphere" ).capturedLinks( "lights" ), { capturedLightA } )
+
+		# Changing the geometry requires a new object, which must be
+		# linked even though the links themselves haven't changed.
+
+		sphere["radius"].setValue( 2 )
+		controller.update()
+		self.assertEqual( renderer.capturedObject( "/group/sphere" ).capturedSamples()[0].radius(), 2 )
+		self.assertEqual( renderer.capturedObject( "/group/sphere" ).capturedLinks( "lights" ), { capturedLightA } )
+
+		del capturedLightA
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testLightLinkPerformance( self ) :
 
@@ -330,6 +492,83 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 		links = renderer.capturedObject( "/group/spheres/instances/sphere/0" ).capturedLinks( "lights" )
 		self.assertEqual( len( links ), numLights )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManyLightsPerformance( self ) :
+
+		numSpheres = 100000
+		numLights = 10000
+
+		sphere = GafferScene.Sphere()
+
+		spherePlane = GafferScene.Plane()
+		spherePlane["name"].setValue( "spheres" )
+		spherePlane["divisions"].setValue( imath.V2i( 1, numSpheres / 2 - 1 ) )
+
+		sphereInstancer = GafferScene.Instancer()
+		sphereInstancer["in"].setInput( spherePlane["out"] )
+		sphereInstancer["prototypes"].setInput( sphere["out"] )
+		sphereInstancer["parent"].setValue( "/spheres" )
+
+		light = GafferSceneTest.TestLight()
+
+		lightPlane = GafferScene.Plane()
+		lightPlane["name"].setValue( "lights" )
+		lightPlane["divisions"].setValue( imath.V2i( 1, numLights / 2 - 1 ) )
+
+		lightInstancer = GafferScene.Instancer()
+		lightInstancer["in"].setInput( lightPlane["out"] )
+		lightInstancer["prototypes"].setInput( light["out"] )
+		lightInstancer["parent"].setValue( "/lights" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphereInstancer["out"] )
+		group["in"][1].setInput( lightInstancer["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( group["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			controller.update()
+
+		self.assertIsNotNone( renderer.capturedObject( "/group/lights/instances/light/{}".format( numLights - 1 ) ) )
+		self.assertIsNotNone( renderer.capturedObject( "/group/spheres/instances/sphere/{}".format( numSpheres - 1 ) ) )
+
+	def testLightFilterLinks( self ) :
+
+		light = GafferSceneTest.TestLight()
+		light["name"].setValue( "light" )
+
+		lightFilter = GafferSceneTest.TestLightFilter()
+		lightFilter["name"].setValue( "lightFilter" )
+		lightFilter["filteredLights"].setValue( "defaultLights" )
+
+		sphere = GafferScene.Sphere()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( light["out"] )
+		group["in"][1].setInput( lightFilter["out"] )
+		group["in"][2].setInput( sphere["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( group["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		# Lights and light filters are output concurrently, but the links
+		# between them must still be made on the first update.
+
+		capturedLight = renderer.capturedObject( "/group/light" )
+		capturedLightFilter = renderer.capturedObject( "/group/lightFilter" )
+		self.assertEqual( capturedLight.capturedLinks( "lightFilters" ), { capturedLightFilter } )
+		self.assertIsNotNone( renderer.capturedObject( "/group/sphere" ) )
+
+		lightFilter["filteredLights"].setValue( "" )
+		controller.update()
+		self.assertEqual( capturedLight.capturedLinks( "lightFilters" ), set() )
+
+		del capturedLight, capturedLightFilter
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testCapsuleDeformPerformance( self ) :
 
@@ -1827,5 +2066,188 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 		controller.update()
 		self.assertTrue( capture.isSame( renderer.capturedObject( "/cube" ) ) )
 
+	def testTargetedAttributeEdits( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 100 )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere10" ] ) )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( duplicate["out"] )
+		attributes["filter"].setInput( pathFilter["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", IECore.IntData( 0 ) ) )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( attributes["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 2 )
+		controller.update()
+
+		def assertAttributeValue( value ) :
+
+			self.assertEqual(
+				renderer.capturedObject( "/sphere10" ).capturedAttributes().attributes()["test"],
+				IECore.IntData( value )
+			)
+			self.assertNotIn( "test", renderer.capturedObject( "/sphere11" ).capturedAttributes().attributes() )
+
+		assertAttributeValue( 0 )
+
+		# Edits should be reflected in the render, whether or not they
+		# are the first to be made.
+
+		for value in range( 1, 4 ) :
+
+			with Gaffer.ContextMonitor( attributes ) as monitor :
+				attributes["attributes"][0]["value"].setValue( value )
+				self.assertTrue( controller.updateRequired() )
+				controller.update()
+
+			assertAttributeValue( value )
+
+		# And after the first edit, we should only be visiting the locations
+		# that were actually edited, rather than all 101 spheres.
+
+		self.assertLessEqual(
+			monitor.plugStatistics( attributes["out"]["attributes"] ).numUniqueValues( "scene:path" ),
+			2
+		)
+
+		# Editing the filter changes the locations being edited, and must
+		# update both the old and new locations.
+
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere11" ] ) )
+		self.assertTrue( controller.updateRequired() )
+		controller.update()
+		self.assertNotIn( "test", renderer.capturedObject( "/sphere10" ).capturedAttributes().attributes() )
+		self.assertEqual( renderer.capturedObject( "/sphere11" ).capturedAttributes().attributes()["test"], IECore.IntData( 3 ) )
+
+	def testTargetedTransformEdits( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( sphere["out"] )
+
+		innerGroup = GafferScene.Group()
+		innerGroup["in"][0].setInput( group["out"] )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/group/group" ] ) )
+
+		transform = GafferScene.Transform()
+		transform["in"].setInput( innerGroup["out"] )
+		transform["filter"].setInput( pathFilter["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( transform["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 4 )
+		controller.update()
+
+		# Transforms are inherited, so descendants of the edited location
+		# must be updated too.
+
+		for x in range( 1, 4 ) :
+			transform["transform"]["translate"]["x"].setValue( x )
+			self.assertTrue( controller.updateRequired() )
+			controller.update()
+			for name in [ "sphere", "sphere1" ] :
+				self.assertEqual(
+					renderer.capturedObject( "/group/group/" + name ).capturedTransforms(),
+					[ imath.M44f().translate( imath.V3f( x, 0, 0 ) ) ]
+				)
+
+	def testUntargetedEditsAfterTargetedEdits( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 2 )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere1" ] ) )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( duplicate["out"] )
+		attributes["filter"].setInput( pathFilter["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", IECore.IntData( 0 ) ) )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( attributes["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 2 )
+		controller.update()
+
+		attributes["attributes"][0]["value"].setValue( 1 )
+		controller.update()
+		attributes["attributes"][0]["value"].setValue( 2 )
+		controller.update()
+
+		# Edits upstream of the journaled node can affect any location,
+		# so must still update everything.
+
+		sphere["radius"].setValue( 2 )
+		self.assertTrue( controller.updateRequired() )
+		controller.update()
+		for name in [ "sphere", "sphere1", "sphere2" ] :
+			self.assertEqual( renderer.capturedObject( "/" + name ).capturedSamples()[0].radius(), 2 )
+
+		# As can edits to other plugs on the journaled node.
+
+		attributes["global"].setValue( True )
+		self.assertTrue( controller.updateRequired() )
+		controller.update()
+		for name in [ "sphere", "sphere1", "sphere2" ] :
+			self.assertEqual( renderer.capturedObject( "/" + name ).capturedAttributes().attributes()["test"], IECore.IntData( 2 ) )
+
+	def testIdenticalAttributesAreShared( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 10 )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere1" ] ) )
+
+		attributes = GafferScene.CustomAttributes()
+		attributes["in"].setInput( duplicate["out"] )
+		attributes["filter"].setInput( pathFilter["out"] )
+		attributes["attributes"].addChild( Gaffer.NameValuePlug( "test", IECore.IntData( 0 ) ) )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( attributes["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 2 )
+		controller.update()
+
+		def assertShared() :
+
+			names = [ "sphere" ] + [ "sphere{}".format( i ) for i in range( 2, 11 ) ]
+			capturedAttributes = renderer.capturedObject( "/sphere" ).capturedAttributes()
+			for name in names :
+				self.assertTrue( renderer.capturedObject( "/" + name ).capturedAttributes().isSame( capturedAttributes ) )
+			self.assertFalse( renderer.capturedObject( "/sphere1" ).capturedAttributes().isSame( capturedAttributes ) )
+
+		assertShared()
+		numAttributes = renderer.statistics().attributes
+
+		# Edited attributes are only converted once, and locations with
+		# unchanged attributes continue to share.
+
+		attributes["attributes"][0]["value"].setValue( 1 )
+		controller.update()
+		assertShared()
+		self.assertEqual( renderer.capturedObject( "/sphere1" ).capturedAttributes().attributes()["test"], IECore.IntData( 1 ) )
+		self.assertEqual( renderer.statistics().attributes, numAttributes + 1 )
+
 if __name__ == "__main__":
 	unittest.main()
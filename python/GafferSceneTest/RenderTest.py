@@ -0,0 +1,105 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import inspect
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferTest
+import GafferScene
+import GafferSceneTest
+
+class RenderTest( GafferSceneTest.SceneTestCase ) :
+
+	def setUp( self ) :
+
+		GafferSceneTest.SceneTestCase.setUp( self )
+
+		# Disable the compute cache, so that every set we need
+		# is computed unless the render reuses it.
+		self.addCleanup( Gaffer.ValuePlug.setCacheMemoryLimit, Gaffer.ValuePlug.getCacheMemoryLimit() )
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+
+	def testSetsReusedBetweenFrames( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+
+		script["sphereExpression"] = Gaffer.Expression()
+		script["sphereExpression"].setExpression( 'parent["sphere"]["radius"] = context.getFrame()' )
+
+		script["filter"] = GafferScene.PathFilter()
+		script["filter"]["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		script["set"] = GafferScene.Set()
+		script["set"]["in"].setInput( script["sphere"]["out"] )
+		script["set"]["filter"].setInput( script["filter"]["out"] )
+		script["set"]["name"].setValue( "render:A" )
+
+		script["render"] = GafferScene.Render()
+		script["render"]["in"].setInput( script["set"]["out"] )
+		script["render"]["renderer"].setValue( "Capturing" )
+
+		def setComputeCount( frames ) :
+
+			with Gaffer.PerformanceMonitor() as monitor :
+				script["render"]["task"].executeSequence( frames )
+
+			# The Set node only computes this when computing "render:A".
+			return monitor.plugStatistics( script["set"]["__pathMatcher"] ).computeCount
+
+		# The object changes every frame, but the set doesn't, so it is only
+		# computed for the first frame, however many frames are rendered.
+
+		self.assertEqual( setComputeCount( [ 1, 2 ] ), 1 )
+		self.assertEqual( setComputeCount( [ 1, 2, 3, 4 ] ), 1 )
+
+		# When the set depends on the frame, it is recomputed for every frame.
+
+		script["sphereExpression"].setExpression( inspect.cleandoc(
+			"""
+			parent["sphere"]["radius"] = context.getFrame()
+			parent["filter"]["paths"] = IECore.StringVectorData( [ "/sphere" ] if context.getFrame() % 2 else [] )
+			"""
+		) )
+
+		self.assertEqual( setComputeCount( [ 1, 2, 3, 4 ] ), 4 )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import inspect
 import unittest
 
 import imath
@@ -69,13 +70,19 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 		procedural["parameters"]["frame"] = Gaffer.NameValuePlug( "frame", 0.0 )
 		procedural["parameters"]["frame"]["value"].setInput( frame["output"] )
 
-		with Gaffer.Context() as c :
+		with Gaffer.Context() as c, Gaffer.PerformanceMonitor() as monitor :
 			c["scene:path"] = IECore.InternedStringVectorData( [ "procedural" ] )
-			samples = GafferScene.Private.RendererAlgo.objectSamples( procedural["out"]["object"], [ 0.75, 1.25 ] )
+			samples = GafferScene.Private.RendererAlgo.objectSamples( procedural["out"]["object"], [ 0.75, 1.25, 1.5 ] )
 
 		self.assertEqual( len( samples ), 1 )
 		self.assertEqual( samples[0].parameters()["frame"].value, 1.0 )
 
+		# Only the first shutter sample needed computing to discover that
+		# the object can't be interpolated. The others were skipped in favour
+		# of the on-frame sample.
+
+		self.assertEqual( monitor.plugStatistics( procedural["out"]["object"] ).computeCount, 2 )
+
 	def testObjectSamplesForCameras( self ) :
 
 		frame = GafferTest.FrameNode()
@@ -592,6 +599,152 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 			self.assertEqual( [ s.translation().x for s in samples ], [ 0.0 ] )
 			self.assertNotEqual( h, IECore.MurmurHash() )
 
+	def testMotionSamplesAreDeterministic( self ) :
+
+		frame = GafferTest.FrameNode()
+
+		sphere = GafferScene.Sphere()
+		sphere["type"].setValue( sphere.Type.Primitive )
+		sphere["radius"].setInput( frame["output"] )
+		sphere["transform"]["translate"]["x"].setInput( frame["output"] )
+
+		sampleTimes = [ 0.75 + i * 0.05 for i in range( 0, 11 ) ]
+
+		with Gaffer.Context() as c :
+
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+
+			expectedObjectHash = IECore.MurmurHash()
+			expectedTransformHash = IECore.MurmurHash()
+			for t in sampleTimes :
+				c.setFrame( t )
+				expectedObjectHash.append( sphere["out"]["object"].hash() )
+				expectedTransformHash.append( sphere["out"]["transform"].hash() )
+			c.setFrame( 1 )
+
+			# Samples are evaluated in parallel, but must still be
+			# returned in order, with a hash that matches a serial
+			# evaluation.
+
+			for i in range( 0, 10 ) :
+
+				h = IECore.MurmurHash()
+				samples = GafferScene.Private.RendererAlgo.objectSamples( sphere["out"]["object"], sampleTimes, h )
+				self.assertEqual( [ s.radius() for s in samples ], [ self.__frameRadius( t ) for t in sampleTimes ] )
+				self.assertEqual( h, expectedObjectHash )
+
+				h = IECore.MurmurHash()
+				samples = GafferScene.Private.RendererAlgo.transformSamples( sphere["out"]["transform"], sampleTimes, h )
+				self.assertEqual( [ s.translation().x for s in samples ], [ self.__frameRadius( t ) for t in sampleTimes ] )
+				self.assertEqual( h, expectedTransformHash )
+
+	@staticmethod
+	def __frameRadius( frame ) :
+
+		# Round trip through single precision, as the plugs do.
+		return imath.V3f( frame ).x
+
+	def testMotionSamplesWithRenderer( self ) :
+
+		frame = GafferTest.FrameNode()
+
+		sphere = GafferScene.Sphere()
+		sphere["type"].setValue( sphere.Type.Primitive )
+		sphere["radius"].setInput( frame["output"] )
+
+		attributes = GafferScene.StandardAttributes()
+		attributes["in"].setInput( sphere["out"] )
+		attributes["attributes"]["deformationBlurSegments"]["enabled"].setValue( True )
+		attributes["attributes"]["deformationBlurSegments"]["value"].setValue( 4 )
+
+		options = GafferScene.StandardOptions()
+		options["in"].setInput( attributes["out"] )
+		options["options"]["deformationBlur"]["enabled"].setValue( True )
+		options["options"]["deformationBlur"]["value"].setValue( True )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		renderOptions = GafferScene.Private.RendererAlgo.RenderOptions( options["out"] )
+		renderSets = GafferScene.Private.RendererAlgo.RenderSets( options["out"] )
+		lightLinks = GafferScene.Private.RendererAlgo.LightLinks()
+
+		GafferScene.Private.RendererAlgo.outputObjects(
+			options["out"], renderOptions, renderSets, lightLinks, renderer
+		)
+
+		capturedSphere = renderer.capturedObject( "/sphere" )
+		self.assertEqual( capturedSphere.capturedSampleTimes(), [ 0.75, 0.875, 1.0, 1.125, 1.25 ] )
+		self.assertEqual(
+			[ s.radius() for s in capturedSphere.capturedSamples() ],
+			capturedSphere.capturedSampleTimes()
+		)
+
+	def testAttributesCacheSharedBetweenOutputs( self ) :
+
+		sphere = GafferScene.Sphere()
+		camera = GafferScene.Camera()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( camera["out"] )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		renderOptions = GafferScene.Private.RendererAlgo.RenderOptions( group["out"] )
+		renderSets = GafferScene.Private.RendererAlgo.RenderSets( group["out"] )
+		lightLinks = GafferScene.Private.RendererAlgo.LightLinks()
+		attributesCache = GafferScene.Private.IECoreScenePreview.AttributesCache( renderer )
+
+		GafferScene.Private.RendererAlgo.outputCameras(
+			group["out"], renderOptions, renderSets, renderer, attributesCache = attributesCache
+		)
+		GafferScene.Private.RendererAlgo.outputObjects(
+			group["out"], renderOptions, renderSets, lightLinks, renderer, attributesCache = attributesCache
+		)
+
+		# The camera and sphere have identical attributes, so share
+		# a single AttributesInterface even though they were output
+		# by different calls.
+
+		self.assertTrue(
+			renderer.capturedObject( "/group/camera" ).capturedAttributes().isSame(
+				renderer.capturedObject( "/group/sphere" ).capturedAttributes()
+			)
+		)
+		self.assertGreater( attributesCache.statistics().attributesHits, 0 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testSlowObjectSamplesPerformance( self ) :
+
+		# Simulate an expensive object such as a cache read, by
+		# sleeping in an expression. `time.sleep()` releases the GIL
+		# so this doesn't prevent concurrent evaluation of samples.
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+		script["sphere"]["type"].setValue( GafferScene.Sphere.Type.Primitive )
+
+		script["expression"] = Gaffer.Expression()
+		script["expression"].setExpression( inspect.cleandoc(
+			"""
+			import time
+			time.sleep( 0.1 )
+			parent["sphere"]["radius"] = context.getFrame()
+			"""
+		) )
+
+		sampleTimes = [ 0.75 + i * 0.1 for i in range( 0, 6 ) ]
+
+		with Gaffer.Context() as c :
+			c["scene:path"] = IECore.InternedStringVectorData( [ "sphere" ] )
+			with GafferTest.TestRunner.PerformanceScope() :
+				samples = GafferScene.Private.RendererAlgo.objectSamples( script["sphere"]["out"]["object"], sampleTimes )
+
+		self.assertEqual( len( samples ), len( sampleTimes ) )
+
 	def testPurposes( self ) :
 
 		# /group
@@ -137,3 +137,28 @@ class ResamplePrimitiveVariablesTest( GafferSceneTest.SceneTestCase ) :
 		resample['names'].setValue( "a" )
 
 		self.assertRaises( RuntimeError, lambda : resample["out"].object( "/object" ) )
+
+	def testSharesUnmodifiedData( self ) :
+
+		plane = GafferScene.Plane()
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		resample = GafferScene.ResamplePrimitiveVariables()
+		resample["in"].setInput( plane["out"] )
+		resample["filter"].setInput( planeFilter["out"] )
+		resample["names"].setValue( "P" )
+		resample["interpolation"].setValue( IECoreScene.PrimitiveVariable.Interpolation.Uniform )
+
+		inObject = plane["out"].object( "/plane", _copy = False )
+		outObject = resample["out"].object( "/plane", _copy = False )
+
+		# Resampled variable is new, and the input is untouched.
+		self.assertEqual( outObject["P"].interpolation, IECoreScene.PrimitiveVariable.Interpolation.Uniform )
+		self.assertEqual( inObject["P"].interpolation, IECoreScene.PrimitiveVariable.Interpolation.Vertex )
+		self.assertEqual( len( inObject["P"].data ), 4 )
+		self.assertFalse( outObject["P"].data.isSame( inObject["P"].data ) )
+
+		# Other variables are shared.
+		self.assertTrue( outObject["N"].data.isSame( inObject["N"].data ) )
+		self.assertTrue( outObject["uv"].data.isSame( inObject["uv"].data ) )
@@ -43,6 +43,7 @@ import IECore
 import IECoreScene
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -309,6 +310,63 @@ class ScatterTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertEqual( scatter["out"].object( "/plane/scatter" ).keys(), ["N", "P", "type"] )
 
+	def testMatchesSerialDistribution( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 200 ) )
+
+		scatter = GafferScene.Scatter()
+		scatter["in"].setInput( plane["out"] )
+		scatter["parent"].setValue( "/plane" )
+		scatter["name"].setValue( "scatter" )
+		scatter["density"].setValue( 100000 )
+		scatter["primitiveVariables"].setValue( "*" )
+
+		points = scatter["out"].object( "/plane/scatter" )
+		del points["type"]
+
+		self.assertEqual(
+			points,
+			IECoreScene.MeshAlgo.distributePoints(
+				plane["out"].object( "/plane" ), density = 100000, primitiveVariables = "*"
+			)
+		)
+
+	def testIndependentOfThreadCount( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 200 ) )
+
+		scatter = GafferScene.Scatter()
+		scatter["in"].setInput( plane["out"] )
+		scatter["parent"].setValue( "/plane" )
+		scatter["name"].setValue( "scatter" )
+		scatter["density"].setValue( 100000 )
+
+		points = scatter["out"].object( "/plane/scatter" )
+
+		Gaffer.ValuePlug.clearCache()
+		with IECore.tbb_global_control( IECore.tbb_global_control.parameter.max_allowed_parallelism, 1 ) :
+			self.assertEqual( scatter["out"].object( "/plane/scatter" ), points )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformance( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 1000 ) )
+
+		scatter = GafferScene.Scatter()
+		scatter["in"].setInput( plane["out"] )
+		scatter["parent"].setValue( "/plane" )
+		scatter["name"].setValue( "scatter" )
+		scatter["density"].setValue( 10000000 )
+		scatter["primitiveVariables"].setValue( "*" )
+
+		scatter["in"].object( "/plane" )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			scatter["out"].object( "/plane/scatter" )
+
 	def testInternalConnectionsNotSerialised( self ) :
 
 		s = Gaffer.ScriptNode()
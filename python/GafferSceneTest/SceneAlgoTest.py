@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import math
 import imath
 import inspect
 import unittest
@@ -2250,6 +2251,172 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 			IECore.PathMatcher()
 		)
 
+	def __gridInstancer( self, divisions ) :
+
+		plane = GafferScene.Plane()
+		plane["dimensions"].setValue( imath.V2f( 10 ) )
+		plane["divisions"].setValue( imath.V2i( divisions ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+		sphere["radius"].setValue( 0.01 )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		return plane, planeFilter, sphere, instancer
+
+	def testCulledTraverse( self ) :
+
+		nodes = self.__gridInstancer( 9 )
+		instancer = nodes[-1]
+
+		ancestors = IECore.PathMatcher( [ "/", "/plane", "/plane/instances", "/plane/instances/sphere" ] )
+		def withAncestors( paths ) :
+			result = IECore.PathMatcher( paths )
+			result.addPaths( ancestors )
+			return result
+
+		# Box containing all instances with positive X.
+
+		box = imath.Box3f( imath.V3f( 0, -10, -1 ), imath.V3f( 10, 10, 1 ) )
+		expected = GafferScene.SceneAlgo.findAll(
+			instancer["out"],
+			lambda scene, path : len( path ) == 4 and scene["transform"].getValue().translation().x > 0
+		)
+		self.assertEqual( expected.size(), 50 )
+		self.assertEqual( GafferSceneTest.culledTraverseScene( instancer["out"], box ), withAncestors( expected ) )
+
+		# Same again, but with the box offset by a matrix.
+
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene(
+				instancer["out"],
+				imath.Box3f( imath.V3f( 100, -10, -1 ), imath.V3f( 110, 10, 1 ) ),
+				imath.M44f().translate( imath.V3f( 100, 0, 0 ) )
+			),
+			withAncestors( expected )
+		)
+
+		# Transforms in the scene must be taken into account.
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( instancer["out"] )
+		group["transform"]["translate"].setValue( imath.V3f( -100, 0, 0 ) )
+
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene(
+				group["out"],
+				imath.Box3f( imath.V3f( -100, -10, -1 ), imath.V3f( -90, 10, 1 ) ),
+			),
+			IECore.PathMatcher( [ "/", "/group" ] + [ "/group" + p for p in withAncestors( expected ).paths() if p != "/" ] )
+		)
+
+		# A ray should only hit a single instance.
+
+		position = instancer["out"].fullTransform( "/plane/instances/sphere/12" ).translation()
+		ray = imath.Line3f( position + imath.V3f( 0, 0, 10 ), position + imath.V3f( 0, 0, 9 ) )
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene( instancer["out"], ray ),
+			withAncestors( [ "/plane/instances/sphere/12" ] )
+		)
+
+		# And a ray pointing the wrong way shouldn't hit anything.
+
+		ray = imath.Line3f( position + imath.V3f( 0, 0, 10 ), position + imath.V3f( 0, 0, 11 ) )
+		self.assertEqual( GafferSceneTest.culledTraverseScene( instancer["out"], ray ), IECore.PathMatcher() )
+
+		# A box that doesn't contain anything culls the root.
+
+		box = imath.Box3f( imath.V3f( 100 ), imath.V3f( 101 ) )
+		self.assertEqual( GafferSceneTest.culledTraverseScene( instancer["out"], box ), IECore.PathMatcher() )
+
+	def testCulledTraverseFrustum( self ) :
+
+		nodes = self.__gridInstancer( 9 )
+		instancer = nodes[-1]
+
+		ancestors = IECore.PathMatcher( [ "/", "/plane", "/plane/instances", "/plane/instances/sphere" ] )
+		def withAncestors( paths ) :
+			result = IECore.PathMatcher( paths )
+			result.addPaths( ancestors )
+			return result
+
+		expected = GafferScene.SceneAlgo.findAll(
+			instancer["out"],
+			lambda scene, path : len( path ) == 4 and scene["transform"].getValue().translation().x > 0
+		)
+		self.assertEqual( expected.size(), 50 )
+
+		# Camera positioned above the plane, looking down -Z at it. The
+		# frustum only covers instances with positive X, so the others
+		# are culled.
+
+		worldToCamera = imath.M44f().translate( imath.V3f( 0, 0, 10 ) ).inverse()
+
+		perspective = imath.Frustumf( 1, 100, 0, 0.6, 0.6, -0.6, False )
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene( instancer["out"], perspective, worldToCamera ),
+			withAncestors( expected )
+		)
+
+		orthographic = imath.Frustumf( 1, 100, 0, 6, 6, -6, True )
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene( instancer["out"], orthographic, worldToCamera ),
+			withAncestors( expected )
+		)
+
+		# Narrowing the frustum to a single instance.
+
+		position = instancer["out"].fullTransform( "/plane/instances/sphere/12" ).translation()
+		narrow = imath.Frustumf( 1, 100, -0.001, 0.001, 0.001, -0.001, False )
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene(
+				instancer["out"], narrow,
+				imath.M44f().translate( position + imath.V3f( 0, 0, 10 ) ).inverse()
+			),
+			withAncestors( [ "/plane/instances/sphere/12" ] )
+		)
+
+		# Transforms in the scene must be taken into account.
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( instancer["out"] )
+		group["transform"]["translate"].setValue( imath.V3f( -100, 0, 0 ) )
+
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene(
+				group["out"], perspective, imath.M44f().translate( imath.V3f( -100, 0, 10 ) ).inverse()
+			),
+			IECore.PathMatcher( [ "/", "/group" ] + [ "/group" + p for p in withAncestors( expected ).paths() if p != "/" ] )
+		)
+
+		# A camera looking away from the plane sees nothing.
+
+		cameraToWorld = imath.M44f().rotate( imath.V3f( 0, math.pi, 0 ) ) * imath.M44f().translate( imath.V3f( 0, 0, 10 ) )
+		self.assertEqual(
+			GafferSceneTest.culledTraverseScene( instancer["out"], perspective, cameraToWorld.inverse() ),
+			IECore.PathMatcher()
+		)
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testCulledTraversePerformance( self ) :
+
+		nodes = self.__gridInstancer( 999 )
+		instancer = nodes[-1]
+
+		# Warm up the cache for the parts of the scene needed to compute
+		# the root bound, so that we only measure the traversal.
+		instancer["out"].bound( "/" )
+
+		box = imath.Box3f( imath.V3f( -0.1, -0.1, -1 ), imath.V3f( 0.1, 0.1, 1 ) )
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferSceneTest.culledTraverseScene( instancer["out"], box )
+
 	def testFindAllWithAttribute( self ) :
 
 		# /group
@@ -2301,6 +2468,36 @@ class SceneAlgoTest( GafferSceneTest.SceneTestCase ) :
 			IECore.PathMatcher( [ "/group/light1" ] )
 		)
 
+	def testObjectMemoryUsage( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		primitiveVariables = GafferScene.PrimitiveVariables()
+		primitiveVariables["in"].setInput( sphere["out"] )
+		primitiveVariables["primitiveVariables"].addChild( Gaffer.NameValuePlug( "test", IECore.IntData( 10 ) ) )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+		group["in"][1].setInput( primitiveVariables["out"] )
+
+		sphereObject = sphere["out"].object( "/sphere" )
+
+		usage = GafferScene.SceneAlgo.objectMemoryUsage( group["out"], root = "/group/sphere" )
+		self.assertEqual( usage.numObjects, 1 )
+		self.assertEqual( usage.totalBytes, sphereObject.memoryUsage() )
+		self.assertEqual( usage.uniqueBytes, usage.totalBytes )
+
+		# The second sphere shares all its data with the first, apart from
+		# the variable added by the PrimitiveVariables node.
+
+		usage = GafferScene.SceneAlgo.objectMemoryUsage( group["out"] )
+		self.assertEqual( usage.numObjects, 2 )
+		self.assertGreater( usage.totalBytes, 2 * sphereObject.memoryUsage() )
+		self.assertLess( usage.uniqueBytes, usage.totalBytes - sphereObject["P"].data.memoryUsage() )
+
+		self.assertEqual( GafferScene.SceneAlgo.objectMemoryUsage( group["out"], root = "/group" ).numObjects, 2 )
+		self.assertEqual( GafferScene.SceneAlgo.objectMemoryUsage( GafferScene.ScenePlug() ).numObjects, 0 )
+
 	def tearDown( self ) :
 
 		GafferSceneTest.SceneTestCase.tearDown( self )
@@ -542,6 +542,62 @@ class SceneReaderTest( GafferSceneTest.SceneTestCase ) :
 			sceneReader["refreshCount"].setValue( sceneReader["refreshCount"].getValue() + 1 )
 			GafferSceneTest.traverseScene( sceneReader["out"] )
 
+	def testPrefetch( self ) :
+
+		mesh = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ) )
+		filePath = self.temporaryDirectory() / "test.scc"
+
+		root = IECoreScene.SceneInterface.create( str( filePath ), IECore.IndexedIO.OpenMode.Write )
+		for i in range( 0, 10 ) :
+			child = root.createChild( "child{}".format( i ) )
+			child.writeTransform( IECore.M44dData( imath.M44d().translate( imath.V3d( i, 0, 0 ) ) ), 0 )
+			for j in range( 0, 10 ) :
+				grandChild = child.createChild( "grandChild{}".format( j ) )
+				grandChild.writeTransform( IECore.M44dData( imath.M44d().translate( imath.V3d( 0, j, 0 ) ) ), 0 )
+				grandChild.writeObject( mesh, 0 )
+
+		del root, child, grandChild
+
+		reader = GafferScene.SceneReader()
+		reader["fileName"].setValue( filePath )
+
+		prefetchingReader = GafferScene.SceneReader()
+		prefetchingReader["fileName"].setValue( filePath )
+		prefetchingReader["prefetchDepth"].setValue( 2 )
+		prefetchingReader["prefetchObjects"].setValue( True )
+
+		# Prefetching doesn't affect the result.
+
+		self.assertScenesEqual( prefetchingReader["out"], reader["out"] )
+
+		# Including when the file is refreshed, and when prefetching
+		# is interleaved with computes from another thread.
+
+		for i in range( 0, 10 ) :
+			prefetchingReader["refreshCount"].setValue( i + 1 )
+			reader["refreshCount"].setValue( i + 1 )
+			GafferSceneTest.traverseScene( prefetchingReader["out"] )
+			self.assertScenesEqual( prefetchingReader["out"], reader["out"] )
+
+		# And when prefetched data is discarded, either because it exceeds
+		# the memory limit or because the caches are cleared.
+
+		memoryLimit = GafferScene.SceneReader.getPrefetchMemoryLimit()
+		self.addCleanup( GafferScene.SceneReader.setPrefetchMemoryLimit, memoryLimit )
+		GafferScene.SceneReader.setPrefetchMemoryLimit( 1024 )
+		self.assertEqual( GafferScene.SceneReader.getPrefetchMemoryLimit(), 1024 )
+
+		prefetchingReader["refreshCount"].setValue( 100 )
+		reader["refreshCount"].setValue( 100 )
+		self.assertScenesEqual( prefetchingReader["out"], reader["out"] )
+
+		GafferScene.SceneReader.setPrefetchMemoryLimit( memoryLimit )
+		prefetchingReader["refreshCount"].setValue( 101 )
+		reader["refreshCount"].setValue( 101 )
+		prefetchingReader["out"].childNames( "/" )
+		Gaffer.ValuePlug.clearCache()
+		self.assertScenesEqual( prefetchingReader["out"], reader["out"] )
+
 	def testGlobalHashesUseFileNameValue( self ) :
 
 		# This models a situation where a complex asset-managed reader uses a
@@ -413,6 +413,91 @@ class SceneWriterTest( GafferSceneTest.SceneTestCase ) :
 		reader["fileName"].setInput( writer["fileName"] )
 		self.assertScenesEqual( reader["out"], writer["in"] )
 
+	def testErrorsDontHang( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["expression"] = Gaffer.Expression()
+		sphere["expression"].setExpression( 'parent["radius"] = context["nonexistent"]' )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+
+		writer = GafferScene.SceneWriter()
+		writer["in"].setInput( group["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+
+		with self.assertRaisesRegex( Gaffer.ProcessException, "nonexistent" ) :
+			writer["task"].execute()
+
+	def testWriteErrorsDontHang( self ) :
+
+		# Enough locations to fill the queue between the
+		# producers and the writer thread.
+
+		sphere = GafferScene.Sphere()
+
+		sphereFilter = GafferScene.PathFilter()
+		sphereFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["filter"].setInput( sphereFilter["out"] )
+		duplicate["copies"].setValue( 2000 )
+
+		writer = GafferScene.SceneWriter()
+		writer["in"].setInput( duplicate["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "test.scc" )
+
+		# SceneCache requires sample times to be increasing, so writing the
+		# same frame twice makes the SceneInterface throw on the writer thread.
+		# That must be reported to the caller rather than leaving the
+		# producers blocked on a full queue.
+
+		with self.assertRaises( RuntimeError ) :
+			writer["task"].executeSequence( [ 1, 1 ] )
+
+		# And we should be able to write successfully afterwards.
+
+		writer["task"].execute()
+
+		reader = GafferScene.SceneReader()
+		reader["fileName"].setInput( writer["fileName"] )
+		self.assertEqual( reader["out"].childNames( "/" ), writer["in"].childNames( "/" ) )
+
+	def __writePerformance( self, extension ) :
+
+		# Around 100,000 instances.
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 316 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		sphere = GafferScene.Sphere()
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( plane["out"] )
+		instancer["prototypes"].setInput( sphere["out"] )
+		instancer["filter"].setInput( planeFilter["out"] )
+
+		writer = GafferScene.SceneWriter()
+		writer["in"].setInput( instancer["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / ( "test." + extension ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			writer["task"].execute()
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testSceneCacheWritePerformance( self ) :
+
+		self.__writePerformance( "scc" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testUSDWritePerformance( self ) :
+
+		self.__writePerformance( "usd" )
+
 	def testAnimatedSets( self ) :
 
 		# `IECoreScene::SceneInterface` doesn't support animated sets, so we
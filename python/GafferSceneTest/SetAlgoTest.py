@@ -40,6 +40,7 @@ import functools
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferScene
 import GafferSceneTest
 
@@ -311,6 +312,65 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertFalse( GafferScene.SetAlgo.affectsSetExpression( Gaffer.IntPlug() ) )
 
+	def __manySets( self, numSets, numPathsPerSet ) :
+
+		# Returns a scene with sets named `set0`, `set1` etc. Each set contains
+		# its own unique paths, plus the shared path `/shared`.
+
+		sphere = GafferScene.Sphere()
+		nodes = [ sphere ]
+		for i in range( 0, numSets ) :
+			setNode = GafferScene.Set()
+			setNode["in"].setInput( nodes[-1]["out"] )
+			setNode["name"].setValue( "set{}".format( i ) )
+			setNode["paths"].setValue(
+				IECore.StringVectorData(
+					[ "/shared" ] + [ "/set{}/path{}".format( i, j ) for j in range( 0, numPathsPerSet ) ]
+				)
+			)
+			nodes.append( setNode )
+
+		return nodes
+
+	def testLongChains( self ) :
+
+		nodes = self.__manySets( 20, 10 )
+		scene = nodes[-1]["out"]
+
+		allPaths = { "/shared" } | { "/set{}/path{}".format( i, j ) for i in range( 0, 20 ) for j in range( 0, 10 ) }
+		setPaths = lambda i : { "/shared" } | { "/set{}/path{}".format( i, j ) for j in range( 0, 10 ) }
+
+		self.assertCorrectEvaluation( scene, "set*", allPaths )
+		self.assertCorrectEvaluation( scene, " | ".join( "set{}".format( i ) for i in range( 0, 20 ) ), allPaths )
+		self.assertCorrectEvaluation( scene, " ".join( "set{}".format( i ) for i in range( 0, 20 ) ), allPaths )
+		self.assertCorrectEvaluation( scene, " & ".join( "set{}".format( i ) for i in range( 0, 20 ) ), { "/shared" } )
+		self.assertCorrectEvaluation( scene, "set*1 & set1*", setPaths( 1 ) | setPaths( 11 ) )
+		self.assertCorrectEvaluation( scene, "(set0 | set1) & set1 & (set1 | set2)", setPaths( 1 ) )
+		self.assertCorrectEvaluation( scene, "set0 set1 - set1", setPaths( 0 ) )
+		self.assertCorrectEvaluation( scene, "set0 | set1 - /shared", setPaths( 0 ) | setPaths( 1 ) - { "/shared" } )
+		self.assertCorrectEvaluation( scene, "set0 | (set1 & set2) | /set3/path0", setPaths( 0 ) | { "/set3/path0" } )
+		self.assertCorrectEvaluation( scene, "set* - /shared - set1?", allPaths - { "/shared" } - set().union( *[ setPaths( i ) for i in range( 10, 20 ) ] ) )
+
+	def testRepeatedSyntaxErrors( self ) :
+
+		# Parsed expressions are cached, and the error must be reported
+		# every time, not just the first.
+		sphere = GafferScene.Sphere()
+		for i in range( 0, 2 ) :
+			with self.assertRaisesRegex( RuntimeError, "Syntax error" ) :
+				GafferScene.SetAlgo.evaluateSetExpression( "setA - (setB", sphere["out"] )
+			with self.assertRaisesRegex( RuntimeError, "Syntax error" ) :
+				GafferScene.SetAlgo.setExpressionHash( "setA - (setB", sphere["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testManySetsPerformance( self ) :
+
+		nodes = self.__manySets( 100, 10000 )
+		expression = " | ".join( "set{}".format( i ) for i in range( 0, 100 ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferScene.SetAlgo.evaluateSetExpression( expression, nodes[-1]["out"] )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
@@ -141,5 +141,22 @@ class ShufflePrimitiveVariablesTest( GafferSceneTest.SceneTestCase ) :
 		self.assertScenesEqual( restoreP["out"], copy["out"], checks = { "bound" } )
 		self.assertSceneHashesEqual( restoreP["out"], copy["out"], checks = { "bound" } )
 
+	def testSharesUnmodifiedData( self ) :
+
+		plane = GafferScene.Plane()
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		shuffle = GafferScene.ShufflePrimitiveVariables()
+		shuffle["in"].setInput( plane["out"] )
+		shuffle["filter"].setInput( planeFilter["out"] )
+		shuffle["shuffles"].addChild( Gaffer.ShufflePlug( "P", "Pref" ) )
+
+		inObject = plane["out"].object( "/plane", _copy = False )
+		outObject = shuffle["out"].object( "/plane", _copy = False )
+		self.assertTrue( outObject["Pref"].data.isSame( inObject["P"].data ) )
+		for name in inObject.keys() :
+			self.assertTrue( outObject[name].data.isSame( inObject[name].data ) )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,88 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import unittest
+import subprocess
+
+import Gaffer
+import GafferTest
+import GafferScene
+import GafferSceneTest
+
+class StatsApplicationTest( GafferTest.TestCase ) :
+
+	def testRenderTranslation( self ) :
+
+		script = Gaffer.ScriptNode()
+
+		script["sphere"] = GafferScene.Sphere()
+		script["light"] = GafferSceneTest.TestLight()
+		script["camera"] = GafferScene.Camera()
+
+		script["duplicate"] = GafferScene.Duplicate()
+		script["duplicate"]["in"].setInput( script["sphere"]["out"] )
+		script["duplicate"]["target"].setValue( "/sphere" )
+		script["duplicate"]["copies"].setValue( 9 )
+
+		script["group"] = GafferScene.Group()
+		script["group"]["in"][0].setInput( script["duplicate"]["out"] )
+		script["group"]["in"][1].setInput( script["light"]["out"] )
+		script["group"]["in"][2].setInput( script["camera"]["out"] )
+
+		script["render"] = GafferScene.Render()
+		script["render"]["in"].setInput( script["group"]["out"] )
+
+		script["fileName"].setValue( self.temporaryDirectory() / "script.gfr" )
+		script.save()
+
+		for node in ( "group", "render" ) :
+
+			o = subprocess.check_output(
+				[
+					str( Gaffer.executablePath() ), "stats", script["fileName"].getValue(),
+					"-scene", node, "-renderTranslation"
+				],
+				universal_newlines = True
+			)
+
+			self.assertIn( "Render translation :", o )
+			self.assertRegex( o, r"Objects\s+10\n" )
+			self.assertRegex( o, r"Lights\s+1\n" )
+			self.assertRegex( o, r"Cameras\s+1\n" )
+			self.assertRegex( o, r"Locations per second\s+[0-9.]+\n" )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -177,6 +177,8 @@ from .RenderPassesTest import RenderPassesTest
 from .DeleteRenderPassesTest import DeleteRenderPassesTest
 from .RenderPassWedgeTest import RenderPassWedgeTest
 from .RenderAdaptorTest import RenderAdaptorTest
+from .RenderTest import RenderTest
+from .StatsApplicationTest import StatsApplicationTest
 
 from .IECoreScenePreviewTest import *
 from .IECoreGLPreviewTest import *
@@ -114,6 +114,38 @@ Gaffer.Metadata.registerNode(
 
 		],
 
+		"prefetchDepth" : [
+
+			"description",
+			"""
+			Improves performance when reading from slow filesystems, by
+			reading ahead in the background. When the child names for a
+			location are computed, the bounds and transforms of this many
+			levels of descendants are read in anticipation of them being
+			needed next. A value of 0 disables prefetching.
+
+			Prefetched data is held in memory until it is needed, up to
+			a limit of 512Mb shared by all SceneReaders. This can be
+			changed using `SceneReader.setPrefetchMemoryLimit()`.
+			""",
+
+			"layout:section", "Prefetch",
+
+		],
+
+		"prefetchObjects" : [
+
+			"description",
+			"""
+			Includes objects in the data read by `prefetchDepth`. This
+			can increase memory usage significantly for scenes where
+			not all objects are required.
+			""",
+
+			"layout:section", "Prefetch",
+
+		],
+
 	}
 
 )
@@ -1179,6 +1179,49 @@ class RendererTest( GafferTest.TestCase ) :
 				"polyAdaptiveSubdivideLinearAttributes2",
 			)
 
+	def testInstancesMethod( self ) :
+
+		r = GafferScene.Private.IECoreScenePreview.Renderer.create(
+			"Arnold",
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.SceneDescription,
+			str( self.temporaryDirectory() / "test.ass" )
+		)
+
+		plane = IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ) )
+
+		defaultAttributes = r.attributes( IECore.CompoundObject() )
+		noInstanceAttributes = r.attributes(
+			IECore.CompoundObject( {
+				"gaffer:automaticInstancing" : IECore.BoolData( 0 ),
+			} )
+		)
+
+		transforms = [ imath.M44f().translate( imath.V3f( i, 0, 0 ) ) for i in range( 0, 3 ) ]
+		r.instances( [ "instance0", "instance1", "instance2" ], [ plane ], [], transforms, [], defaultAttributes )
+		r.instances( [ "noInstance0", "noInstance1" ], [ plane ], [], transforms[:2], [], noInstanceAttributes )
+
+		with self.assertRaisesRegex( RuntimeError, "Wrong number of transforms" ) :
+			r.instances( [ "wrongTransforms" ], [ plane ], [], transforms, [], defaultAttributes )
+
+		r.render()
+		del defaultAttributes, noInstanceAttributes
+		del r
+
+		with IECoreArnold.UniverseBlock( writable = True ) as universe :
+
+			arnold.AiSceneLoad( universe, str( self.temporaryDirectory() / "test.ass" ), None )
+
+			shapes = self.__allNodes( universe, type = arnold.AI_NODE_SHAPE )
+			numPolyMeshes = len( [ s for s in shapes if arnold.AiNodeEntryGetName( arnold.AiNodeGetNodeEntry( s ) ) == "polymesh" ] )
+			self.assertEqual( numPolyMeshes, 3 )
+
+			self.__assertInstanced( universe, "instance0", "instance1", "instance2" )
+			self.__assertNotInstanced( universe, "noInstance0", "noInstance1" )
+
+			for i in range( 0, 3 ) :
+				node = arnold.AiNodeLookUpByName( universe, "instance{}".format( i ) )
+				self.assertEqual( self.__m44f( arnold.AiNodeGetMatrix( node, "matrix" ) ), transforms[i] )
+
 	def testTransformTypeAttribute( self ) :
 
 		r = GafferScene.Private.IECoreScenePreview.Renderer.create(
@@ -43,6 +43,8 @@
 #include "IECore/NullObject.h"
 #include "IECore/StringAlgo.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace IECore;
 using namespace Gaffer;
@@ -230,20 +232,24 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 	}
 	else if( output == colorDataPlug() )
 	{
+		const string &layerName = context->get<string>( g_layerNameKey );
+
 		ConstStringVectorDataPtr channelNamesData;
-		ConstColorProcessorDataPtr colorProcessorData;
+		vector<ColorProcessorFunction> processors;
+		const ImagePlug *sourcePlug;
 		bool unpremult;
 		{
 			ImagePlug::GlobalScope globalScope( context );
 			channelNamesData = inPlug()->channelNamesPlug()->getValue();
 			unpremult = processUnpremultipliedPlug()->getValue();
-			colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
+			ConstColorProcessorDataPtr colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( colorProcessorPlug()->getValue() );
+			processors.push_back( colorProcessorData->colorProcessor );
+			sourcePlug = fusedInput( channelNamesData->readable(), layerName, unpremult, processors );
 		}
 		const vector<string> &channelNames = channelNamesData->readable();
 
-		const string &layerName = context->get<string>( g_layerNameKey );
-
 		FloatVectorDataPtr rgb[3];
+		bool missing[3];
 		ConstFloatVectorDataPtr alpha;
 		int samples = -1;
 		{
@@ -252,7 +258,7 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 			if( unpremult && ImageAlgo::channelExists( channelNames, ImageAlgo::channelNameA ) )
 			{
 				channelDataScope.setChannelName( &ImageAlgo::channelNameA );
-				alpha = inPlug()->channelDataPlug()->getValue();
+				alpha = sourcePlug->channelDataPlug()->getValue();
 			}
 
 			int i = 0;
@@ -262,7 +268,7 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 				if( ImageAlgo::channelExists( channelNames, channelName ) )
 				{
 					channelDataScope.setChannelName( &channelName );
-					rgb[i] = inPlug()->channelDataPlug()->getValue()->copy();
+					rgb[i] = sourcePlug->channelDataPlug()->getValue()->copy();
 
 					samples = rgb[i]->readable().size();
 
@@ -295,7 +301,8 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 
 			for( int k = 0; k < 3; k++ )
 			{
-				if( !rgb[k] )
+				missing[k] = !rgb[k];
+				if( missing[k] )
 				{
 					rgb[k] = new FloatVectorData();
 					rgb[k]->writable().resize( samples, 0.0f );
@@ -304,7 +311,32 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 
 		}
 
-		colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
+		// Apply the fused chain of processors, starting with the furthest upstream.
+		bool first = true;
+		for( auto it = processors.rbegin(); it != processors.rend(); ++it )
+		{
+			if( !*it )
+			{
+				continue;
+			}
+
+			if( !first )
+			{
+				// Channels missing from the image aren't output by the upstream
+				// processor, so unfused, the next processor would read them as
+				// black. Reset them to match.
+				for( int k = 0; k < 3; k++ )
+				{
+					if( missing[k] )
+					{
+						std::fill( rgb[k]->writable().begin(), rgb[k]->writable().end(), 0.0f );
+					}
+				}
+			}
+
+			(*it)( rgb[0].get(), rgb[1].get(), rgb[2].get() );
+			first = false;
+		}
 
 		if( unpremult && alpha )
 		{
@@ -340,6 +372,56 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 	ImageProcessor::compute( output, context );
 }
 
+const ImagePlug *ColorProcessor::fusedInput( const std::vector<std::string> &channelNames, const std::string &layerName, bool unpremult, std::vector<ColorProcessorFunction> &processors ) const
+{
+	const ImagePlug *result = inPlug();
+	while( true )
+	{
+		const ImagePlug *source = result->channelDataPlug()->source()->parent<ImagePlug>();
+		const ColorProcessor *upstream = source ? runTimeCast<const ColorProcessor>( source->node() ) : nullptr;
+		if( !upstream || source != upstream->outPlug() )
+		{
+			return result;
+		}
+
+		if( upstream->enabledPlug()->getValue() )
+		{
+			ConstColorProcessorDataPtr colorProcessorData = boost::static_pointer_cast<const ColorProcessorData>( upstream->colorProcessorPlug()->getValue() );
+			if( colorProcessorData->colorProcessor )
+			{
+				// We can only fuse if the upstream node processes all of the
+				// channels we're going to read, or none of them.
+				const std::string channels = upstream->channelsPlug()->getValue();
+				size_t numExisting = 0;
+				size_t numProcessed = 0;
+				for( const auto &baseName : { "R", "G", "B" } )
+				{
+					const string channelName = ImageAlgo::channelName( layerName, baseName );
+					if( ImageAlgo::channelExists( channelNames, channelName ) )
+					{
+						numExisting++;
+						if( StringAlgo::matchMultiple( channelName, channels ) )
+						{
+							numProcessed++;
+						}
+					}
+				}
+
+				if( numProcessed )
+				{
+					if( numProcessed != numExisting || upstream->processUnpremultipliedPlug()->getValue() != unpremult )
+					{
+						return result;
+					}
+					processors.push_back( colorProcessorData->colorProcessor );
+				}
+			}
+		}
+
+		result = upstream->inPlug();
+	}
+}
+
 Gaffer::ValuePlug::CachePolicy ColorProcessor::computeCachePolicy( const Gaffer::ValuePlug *output ) const
 {
 	if( output == outPlug()->channelDataPlug() )
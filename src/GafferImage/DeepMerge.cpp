@@ -179,6 +179,7 @@ void DeepMerge::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	{
 		unsigned int plugIndex;
 		Box2i boundInTile;
+		ConstIntVectorDataPtr sampleOffsets;
 	};
 	std::vector<InputStruct> inputs;
 
@@ -202,11 +203,28 @@ void DeepMerge::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 					continue;
 				}
 				Box2i boundInTile( validBound.min - tileOrigin, validBound.max - tileOrigin );
-				inputs.push_back( { j, boundInTile } );
+				inputs.push_back( { j, boundInTile, nullptr } );
 			}
 		}
 	}
 
+	// Inputs without any samples in this tile contribute nothing, so we omit them
+	// entirely. This means that merging with sparse images costs nothing in the
+	// tiles where they are empty.
+	for( auto &input : inputs )
+	{
+		input.sampleOffsets = inPlugs()->getChild<ImagePlug>( input.plugIndex )->sampleOffsetsPlug()->getValue();
+	}
+	inputs.erase(
+		std::remove_if(
+			inputs.begin(), inputs.end(),
+			[] ( const InputStruct &input ) {
+				return ImagePlug::tileSampleLayout( input.sampleOffsets.get() ) == ImagePlug::TileSampleLayout::Empty;
+			}
+		),
+		inputs.end()
+	);
+
 	unsigned int numInputs = inputs.size();
 
 	IntVectorDataPtr resultData = new IntVectorData();
@@ -226,9 +244,7 @@ void DeepMerge::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 		int plugIndex = inputs[k].plugIndex;
 		result[k] = plugIndex;
 
-		const ImagePlug *inP = inPlugs()->getChild<ImagePlug>( plugIndex );
-		ConstIntVectorDataPtr sampleOffsetsData = inP->sampleOffsetsPlug()->getValue();
-		const std::vector<int> &sampleOffsets = sampleOffsetsData->readable();
+		const std::vector<int> &sampleOffsets = inputs[k].sampleOffsets->readable();
 
 		int *offsets = &result[numInputs + 2 * k];
 
@@ -446,6 +462,13 @@ IECore::ConstFloatVectorDataPtr DeepMerge::computeChannelData( const std::string
 		channelPtrs[j] = &channelDatas[j]->readable()[0];
 	}
 
+	if( numInputs == 1 && channelDatas[0] && (int)channelDatas[0]->readable().size() == offsetsCache.back() )
+	{
+		// Every sample of a single input is being used, in its original order, so
+		// the input data can be passed through without copying.
+		return channelDatas[0];
+	}
+
 	// Now we can loop through just pasting in the samples from each input to each pixel
 	const int *offsets = &offsetsCache[ numInputs ];
 	int prevOffset = 0;
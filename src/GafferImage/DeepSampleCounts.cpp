@@ -120,6 +120,15 @@ IECore::ConstFloatVectorDataPtr DeepSampleCounts::computeChannelData( const std:
 
 	scope.setTileOrigin( &tileOrigin );
 	ConstIntVectorDataPtr sampleOffsetsData = inPlug()->sampleOffsetsPlug()->getValue();
+	switch( ImagePlug::tileSampleLayout( sampleOffsetsData.get() ) )
+	{
+		case ImagePlug::TileSampleLayout::Empty :
+			return ImagePlug::blackTile();
+		case ImagePlug::TileSampleLayout::Flat :
+			return ImagePlug::whiteTile();
+		default :
+			break;
+	}
 
 	FloatVectorDataPtr resultData = new FloatVectorData();
 	auto &result = resultData->writable();
@@ -1052,7 +1052,14 @@ void DeepState::compute( Gaffer::ValuePlug *output, const Gaffer::Context *conte
 	}
 
 	bool isSorted, isTidy;
-	if( hasZ )
+	const ImagePlug::TileSampleLayout sampleLayout = ImagePlug::tileSampleLayout( sampleOffsetsData.get() );
+	if( sampleLayout == ImagePlug::TileSampleLayout::Empty )
+	{
+		// Nothing to sort or merge
+		isSorted = true;
+		isTidy = true;
+	}
+	else if( hasZ )
 	{
 		checkState( sampleOffsetsData->readable(), zData->readable(), zBackData->readable(), isSorted, isTidy );
 	}
@@ -1322,6 +1329,24 @@ IECore::ConstFloatVectorDataPtr DeepState::computeChannelData( const std::string
 		return inData;
 	}
 
+	if( requestedDeepState == TargetState::Flat )
+	{
+		// Fast paths for tiles where flattening is trivial. With a single sample per
+		// pixel there is nothing to composite, and without samples the result is black.
+		ImagePlug::ChannelDataScope sampleOffsetsScope( context );
+		sampleOffsetsScope.remove( ImagePlug::channelNameContextName );
+		ConstIntVectorDataPtr sampleOffsetsData = inPlug()->sampleOffsetsPlug()->getValue();
+		switch( ImagePlug::tileSampleLayout( sampleOffsetsData.get() ) )
+		{
+			case ImagePlug::TileSampleLayout::Empty :
+				return ImagePlug::blackTile();
+			case ImagePlug::TileSampleLayout::Flat :
+				return inData;
+			default :
+				break;
+		}
+	}
+
 	bool isAlpha = channelName == "A";
 	bool isZ = false;
 	if( channelName[0] == 'Z' )
@@ -254,9 +254,22 @@ void ImageNode::compute( ValuePlug *output, const Context *context ) const
 		{
 			throw Exception( "The image:tileOrigin must be a multiple of ImagePlug::tileSize()" );
 		}
-		static_cast<IntVectorDataPlug *>( output )->setValue(
-			computeSampleOffsets( tileOrigin, context, imagePlug )
-		);
+		ConstIntVectorDataPtr sampleOffsets = computeSampleOffsets( tileOrigin, context, imagePlug );
+		// Substitute the shared offsets for equivalent ones, so that downstream
+		// nodes can classify the tile in constant time, and we don't waste memory
+		// caching duplicates.
+		switch( ImagePlug::tileSampleLayout( sampleOffsets.get() ) )
+		{
+			case ImagePlug::TileSampleLayout::Empty :
+				sampleOffsets = ImagePlug::emptyTileSampleOffsets();
+				break;
+			case ImagePlug::TileSampleLayout::Flat :
+				sampleOffsets = ImagePlug::flatTileSampleOffsets();
+				break;
+			default :
+				break;
+		}
+		static_cast<IntVectorDataPlug *>( output )->setValue( sampleOffsets );
 	}
 	else if( output == imagePlug->channelNamesPlug() )
 	{
@@ -182,6 +182,45 @@ const IECore::IntVectorData *ImagePlug::emptyTileSampleOffsets()
 	return g_emptyTileSampleOffsets.get();
 };
 
+ImagePlug::TileSampleLayout ImagePlug::tileSampleLayout( const IECore::IntVectorData *sampleOffsets )
+{
+	if( sampleOffsets == emptyTileSampleOffsets() )
+	{
+		return TileSampleLayout::Empty;
+	}
+	else if( sampleOffsets == flatTileSampleOffsets() )
+	{
+		return TileSampleLayout::Flat;
+	}
+
+	const std::vector<int> &offsets = sampleOffsets->readable();
+	if( (int)offsets.size() != tilePixels() )
+	{
+		return TileSampleLayout::General;
+	}
+
+	// Offsets are monotonic, so the total sample count is enough to identify
+	// an empty tile, and to rule out most tiles that aren't flat.
+	const int numSamples = offsets.back();
+	if( numSamples == 0 )
+	{
+		return TileSampleLayout::Empty;
+	}
+	else if( numSamples != tilePixels() )
+	{
+		return TileSampleLayout::General;
+	}
+
+	for( int i = 0; i < numSamples; ++i )
+	{
+		if( offsets[i] != i + 1 )
+		{
+			return TileSampleLayout::General;
+		}
+	}
+	return TileSampleLayout::Flat;
+}
+
 const IECore::FloatVectorData *ImagePlug::emptyTile()
 {
 	static IECore::ConstFloatVectorDataPtr g_emptyTile( new IECore::FloatVectorData() );
@@ -156,8 +156,6 @@ void Offset::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer
 	}
 	else
 	{
-		ImageProcessor::hashChannelData( parent, context, h );
-
 		const Box2i inDataWindow = inPlug()->dataWindow();
 		const Box2i outTileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
 		const Box2i inBound = BufferAlgo::intersection(
@@ -165,6 +163,16 @@ void Offset::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer
 			Box2i( outTileBound.min - offset, outTileBound.max - offset )
 		);
 
+		if( BufferAlgo::empty( inBound ) )
+		{
+			// No input pixels contribute to this tile, so `computeChannelData()`
+			// will return a shared constant tile.
+			h = inPlug()->deep() ? ImagePlug::emptyTile()->Object::hash() : ImagePlug::blackTile()->Object::hash();
+			return;
+		}
+
+		ImageProcessor::hashChannelData( parent, context, h );
+
 		// Note that two differing output tiles could depend on the same input tile, for
 		// example if the input image is small enough that there is a single valid tile.
 		// Hash in the bound to distinguish the output tiles in this case
@@ -215,6 +223,13 @@ IECore::ConstFloatVectorDataPtr Offset::computeChannelData( const std::string &c
 		Box2i( tileOrigin - offset, tileOrigin + V2i( ImagePlug::tileSize() ) - offset )
 	);
 
+	if( BufferAlgo::empty( inBound ) )
+	{
+		// Share a constant tile rather than allocating a new one, since
+		// there is nothing to copy.
+		return deep ? ImagePlug::emptyTile() : ImagePlug::blackTile();
+	}
+
 	FloatVectorDataPtr outData = new FloatVectorData;
 	ConstIntVectorDataPtr outSampleOffsetsData;
 	if( !deep )
@@ -314,9 +329,6 @@ void Offset::hashSampleOffsets( const GafferImage::ImagePlug *parent, const Gaff
 	}
 	else
 	{
-		ImageProcessor::hashSampleOffsets( parent, context, h );
-
-		h.append( inPlug()->deepHash() );
 		const Box2i inDataWindow = inPlug()->dataWindow();
 
 		const Box2i outTileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
@@ -325,6 +337,16 @@ void Offset::hashSampleOffsets( const GafferImage::ImagePlug *parent, const Gaff
 			Box2i( outTileBound.min - offset, outTileBound.max - offset )
 		);
 
+		if( BufferAlgo::empty( inBound ) )
+		{
+			h = ImagePlug::emptyTileSampleOffsets()->Object::hash();
+			return;
+		}
+
+		ImageProcessor::hashSampleOffsets( parent, context, h );
+
+		h.append( inPlug()->deepHash() );
+
 		// Note that two differing output tiles could depend on the same input tile, for
 		// example if the input image is small enough that there is a single valid tile.
 		// Hash in the bound to distinguish the output tiles in this case
@@ -372,6 +394,11 @@ IECore::ConstIntVectorDataPtr Offset::computeSampleOffsets( const Imath::V2i &ti
 		Box2i( tileOrigin - offset, tileOrigin + V2i( ImagePlug::tileSize() ) - offset )
 	);
 
+	if( BufferAlgo::empty( inBound ) )
+	{
+		return ImagePlug::emptyTileSampleOffsets();
+	}
+
 	IntVectorDataPtr outData = new IntVectorData;
 	std::vector<int> &out = outData->writable();
 	out.resize( ImagePlug::tilePixels(), 0 );
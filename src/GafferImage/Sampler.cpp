@@ -149,3 +149,64 @@ IECore::MurmurHash Sampler::hash() const
 	hash( h );
 	return h;
 }
+
+void Sampler::hash( IECore::MurmurHash &h, const std::vector<Imath::V2i> &regionTileOrigins ) const
+{
+	// Map each region into the tiles of our cache that would be accessed
+	// when sampling from it, taking into account the bounding mode. We use
+	// the same one pixel margin that the constructor applies to the sample
+	// window, to account for the additional lookups made by interpolation.
+	std::vector<bool> usedTiles( m_dataCache.size(), false );
+	for( const V2i &regionTileOrigin : regionTileOrigins )
+	{
+		Box2i region = BufferAlgo::intersection(
+			Box2i( regionTileOrigin - V2i( 1 ), regionTileOrigin + V2i( ImagePlug::tileSize() + 1 ) ),
+			m_sampleWindow
+		);
+		if( BufferAlgo::empty( region ) )
+		{
+			continue;
+		}
+
+		if( m_boundingMode == Black )
+		{
+			region = BufferAlgo::intersection( region, m_dataWindow );
+			if( BufferAlgo::empty( region ) )
+			{
+				continue;
+			}
+		}
+		else if( m_boundingMode == Clamp )
+		{
+			region = Box2i(
+				BufferAlgo::clamp( region.min, m_dataWindow ),
+				BufferAlgo::clamp( region.max - V2i( 1 ), m_dataWindow ) + V2i( 1 )
+			);
+		}
+
+		const V2i minTile = ImagePlug::tileOrigin( region.min );
+		const V2i maxTile = ImagePlug::tileOrigin( region.max - V2i( 1 ) );
+		for( int y = minTile.y; y <= maxTile.y; y += ImagePlug::tileSize() )
+		{
+			for( int x = minTile.x; x <= maxTile.x; x += ImagePlug::tileSize() )
+			{
+				usedTiles[( x >> ImagePlug::tileSizeLog2() ) + m_cacheWidth * ( y >> ImagePlug::tileSizeLog2() ) - m_cacheOriginIndex] = true;
+			}
+		}
+	}
+
+	for( size_t i = 0; i < usedTiles.size(); ++i )
+	{
+		if( usedTiles[i] )
+		{
+			const V2i tileOrigin(
+				m_cacheWindow.min.x + ( (int)i % m_cacheWidth ) * ImagePlug::tileSize(),
+				m_cacheWindow.min.y + ( (int)i / m_cacheWidth ) * ImagePlug::tileSize()
+			);
+			h.append( m_plug->channelDataHash( m_channelName, tileOrigin ) );
+		}
+	}
+	h.append( m_boundingMode );
+	h.append( m_dataWindow );
+	h.append( m_sampleWindow );
+}
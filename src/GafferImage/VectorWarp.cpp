@@ -79,29 +79,44 @@ struct VectorWarp::Engine : public Warp::Engine
 	Imath::V2f inputPixel( const Imath::V2f &outputPixel ) const override
 	{
 		const V2i outputPixelI( (int)floorf( outputPixel.x ), (int)floorf( outputPixel.y ) );
-		const size_t i = BufferAlgo::index( outputPixelI, m_tileBound );
-		if( m_a[i] == 0.0f )
+		return inputPixelInternal( outputPixel, BufferAlgo::index( outputPixelI, m_tileBound ) );
+	}
+
+	void inputPixels( const Imath::V2f &outputPixel, int count, Imath::V2f *result ) const override
+	{
+		const V2i outputPixelI( (int)floorf( outputPixel.x ), (int)floorf( outputPixel.y ) );
+		const size_t index = BufferAlgo::index( outputPixelI, m_tileBound );
+		V2f p = outputPixel;
+		for( int i = 0; i < count; ++i, p.x += 1.0f )
 		{
-			return black;
+			result[i] = inputPixelInternal( p, index + i );
 		}
-		else
-		{
-			V2f result = m_vectorMode == Relative ? outputPixel : V2f( 0.0f );
+	}
 
-			result += m_vectorUnits == Screen ?
-				screenToPixel( V2f( m_x[i], m_y[i] ) ) :
-				V2f( m_x[i], m_y[i] );
+	private :
 
-			if( !std::isfinite( result[0] ) || !std::isfinite( result[1] ) )
+		inline V2f inputPixelInternal( const V2f &outputPixel, size_t i ) const
+		{
+			if( m_a[i] == 0.0f )
 			{
 				return black;
 			}
+			else
+			{
+				V2f result = m_vectorMode == Relative ? outputPixel : V2f( 0.0f );
 
-			return result;
-		}
-	}
+				result += m_vectorUnits == Screen ?
+					screenToPixel( V2f( m_x[i], m_y[i] ) ) :
+					V2f( m_x[i], m_y[i] );
 
-	private :
+				if( !std::isfinite( result[0] ) || !std::isfinite( result[1] ) )
+				{
+					return black;
+				}
+
+				return result;
+			}
+		}
 
 		inline V2f screenToPixel( const V2f &vector ) const
 		{
@@ -44,6 +44,8 @@
 #include "IECore/MessageHandler.h"
 #include "IECore/NullObject.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace boost;
 using namespace Imath;
@@ -56,6 +58,7 @@ namespace
 	IECore::InternedString g_tileInputBoundName( "tileInputBound"  );
 	IECore::InternedString g_pixelInputPositionsName( "pixelInputPositions"  );
 	IECore::InternedString g_pixelInputDerivativesName( "pixelInputDerivatives"  );
+	IECore::InternedString g_inputTileOriginsName( "inputTileOrigins"  );
 
 	const CompoundObject *sampleRegionsEmptyTile()
 	{
@@ -72,6 +75,15 @@ namespace
 		}
 	}
 
+	// Returns the bound of the pixels whose centres fall within `support`.
+	Box2i supportPixelBound( const Box2f &support )
+	{
+		return Box2i(
+			V2i( (int)ceilf( support.min.x - 0.5 ), (int)ceilf( support.min.y - 0.5 ) ),
+			V2i( (int)floorf( support.max.x - 0.5 ) + 1, (int)floorf( support.max.y - 0.5 ) + 1 )
+		);
+	}
+
 	ConstObjectPtr computeEngineIfTileValid( ImagePlug::ChannelDataScope &tileScope, const ObjectPlug *plug, const Box2i &dataWindow, const V2i &tileOrigin )
 	{
 		if( BufferAlgo::intersects( dataWindow, Box2i( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) ) ) )
@@ -119,6 +131,21 @@ float Warp::approximateDerivative( float upper, float center, float lower )
 	}
 }
 
+void Warp::inputPixelRow( const Engine *engine, const V2i &rowOrigin, const Box2i &dataWindow, V2f *result )
+{
+	const int begin = std::clamp( dataWindow.min.x - rowOrigin.x, 0, ImagePlug::tileSize() );
+	const int end = std::clamp( dataWindow.max.x - rowOrigin.x, begin, ImagePlug::tileSize() );
+	if( rowOrigin.y < dataWindow.min.y || rowOrigin.y >= dataWindow.max.y || begin == end )
+	{
+		std::fill( result, result + ImagePlug::tileSize(), Engine::black );
+		return;
+	}
+
+	std::fill( result, result + begin, Engine::black );
+	engine->inputPixels( V2f( rowOrigin.x + begin + 0.5f, rowOrigin.y + 0.5f ), end - begin, result + begin );
+	std::fill( result + end, result + ImagePlug::tileSize(), Engine::black );
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Engine
 //////////////////////////////////////////////////////////////////////////
@@ -127,6 +154,15 @@ Warp::Engine::~Engine()
 {
 }
 
+void Warp::Engine::inputPixels( const Imath::V2f &outputPixel, int count, Imath::V2f *result ) const
+{
+	V2f p = outputPixel;
+	for( int i = 0; i < count; ++i, p.x += 1.0f )
+	{
+		result[i] = inputPixel( p );
+	}
+}
+
 const V2f Warp::Engine::black( std::numeric_limits<float>::infinity() );
 
 //////////////////////////////////////////////////////////////////////////
@@ -475,19 +511,10 @@ void Warp::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context )
 				if( cacheY == -1 ) curEngine = engineMinusY;
 				if( cacheY == ImagePlug::tileSize() ) curEngine = enginePlusY;
 
-				for( int x = 0; x < ImagePlug::tileSize(); x++ )
-				{
-					if( BufferAlgo::contains( dataWindow, V2i( tileOrigin.x + x, tileOrigin.y + cacheY ) ) )
-					{
-						threeRowsCache[ cacheRow * ImagePlug::tileSize() + x ] = curEngine->inputPixel( V2f(
-							( tileOrigin.x + x ) + 0.5,
-							( tileOrigin.y + cacheY ) + 0.5 ) );
-					}
-					else
-					{
-						threeRowsCache[ cacheRow * ImagePlug::tileSize() + x ] = Engine::black;
-					}
-				}
+				inputPixelRow(
+					curEngine, V2i( tileOrigin.x, tileOrigin.y + cacheY ), dataWindow,
+					&threeRowsCache[ cacheRow * ImagePlug::tileSize() ]
+				);
 
 
 				if( cacheY > 0 )
@@ -561,38 +588,84 @@ void Warp::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context )
 		}
 		else
 		{
+			pixelInputPositions.resize( ImagePlug::tilePixels() );
+			pixelInputDerivatives.resize( ImagePlug::tilePixels(), V2f( 1.0f ) );
 			for( int y = 0; y < ImagePlug::tileSize(); y++ )
 			{
+				V2f *rowPositions = &pixelInputPositions[ y * ImagePlug::tileSize() ];
+				inputPixelRow( engine, V2i( tileOrigin.x, tileOrigin.y + y ), dataWindow, rowPositions );
 				for( int x = 0; x < ImagePlug::tileSize(); x++ )
 				{
-					V2f inputPosition( Engine::black );
-					if( BufferAlgo::contains( dataWindow, V2i( tileOrigin.x + x, tileOrigin.y + y ) ) )
+					if( rowPositions[x] != Engine::black )
 					{
-						inputPosition = engine->inputPixel( V2f(
-							( tileOrigin.x + x ) + 0.5,
-							( tileOrigin.y + y ) + 0.5 ) );
-
-						if( inputPosition != Engine::black )
-						{
-							inputBound.extendBy( FilterAlgo::filterSupport( inputPosition, 1.0f, 1.0f,  filterWidth ) );
-						}
+						inputBound.extendBy( FilterAlgo::filterSupport( rowPositions[x], 1.0f, 1.0f,  filterWidth ) );
 					}
-					pixelInputPositions.push_back( inputPosition );
-					pixelInputDerivatives.push_back( V2f( 1.0f ) );
 				}
 			}
 		}
 
 		// Include any pixels where the corner max bound is above the pixel center, and
 		// the corner min bound is below the pixel center
-		Box2i inputPixelBound(
-			V2i( (int)ceilf( inputBound.min.x - 0.5 ), (int)ceilf( inputBound.min.y - 0.5 ) ),
-			V2i( (int)floorf( inputBound.max.x - 0.5 ) + 1, (int)floorf( inputBound.max.y - 0.5 ) + 1 ) );
+		const Box2i inputPixelBound = supportPixelBound( inputBound );
+
+		// With large displacements, the overall bound may cover many tiles that
+		// are never actually sampled, so we also record the specific input tiles
+		// touched by each pixel's filter support. This allows us to hash only the
+		// tiles we need in `hashChannelData()`, rather than every tile in the bound.
+		V2iVectorDataPtr inputTileOriginsData = new V2iVectorData();
+		if( !BufferAlgo::empty( inputPixelBound ) )
+		{
+			const V2i minTile = ImagePlug::tileOrigin( inputPixelBound.min );
+			const V2i maxTile = ImagePlug::tileOrigin( inputPixelBound.max - V2i( 1 ) );
+			const int numTilesX = ( maxTile.x - minTile.x ) / ImagePlug::tileSize() + 1;
+			const int numTilesY = ( maxTile.y - minTile.y ) / ImagePlug::tileSize() + 1;
+			std::vector<bool> touchedTiles( numTilesX * numTilesY, false );
+
+			for( size_t i = 0; i < pixelInputPositions.size(); ++i )
+			{
+				const V2f &inputPosition = pixelInputPositions[i];
+				if( inputPosition == Engine::black )
+				{
+					continue;
+				}
+
+				const Box2i pixelBound = supportPixelBound(
+					FilterAlgo::filterSupport( inputPosition, pixelInputDerivatives[i].x, pixelInputDerivatives[i].y, filterWidth )
+				);
+				if( BufferAlgo::empty( pixelBound ) )
+				{
+					continue;
+				}
+
+				const V2i pixelMinTile = ( ImagePlug::tileOrigin( pixelBound.min ) - minTile ) / ImagePlug::tileSize();
+				const V2i pixelMaxTile = ( ImagePlug::tileOrigin( pixelBound.max - V2i( 1 ) ) - minTile ) / ImagePlug::tileSize();
+				for( int ty = pixelMinTile.y; ty <= pixelMaxTile.y; ++ty )
+				{
+					for( int tx = pixelMinTile.x; tx <= pixelMaxTile.x; ++tx )
+					{
+						touchedTiles[ ty * numTilesX + tx ] = true;
+					}
+				}
+			}
+
+			std::vector<V2i> &inputTileOrigins = inputTileOriginsData->writable();
+			for( int ty = 0; ty < numTilesY; ++ty )
+			{
+				for( int tx = 0; tx < numTilesX; ++tx )
+				{
+					if( touchedTiles[ ty * numTilesX + tx ] )
+					{
+						inputTileOrigins.push_back( minTile + V2i( tx, ty ) * ImagePlug::tileSize() );
+					}
+				}
+			}
+		}
 
 		CompoundObjectPtr sampleRegions = new CompoundObject();
 		sampleRegions->members()[ g_tileInputBoundName ] = new Box2iData( inputPixelBound );
 		sampleRegions->members()[ g_pixelInputPositionsName ] = pixelInputPositionsData;
 		sampleRegions->members()[ g_pixelInputDerivativesName ] = pixelInputDerivativesData;
+		sampleRegions->members()[ g_inputTileOriginsName ] = inputTileOriginsData;
 		static_cast<CompoundObjectPlug *>( output )->setValue( sampleRegions );
 		return;
 	}
@@ -623,6 +696,7 @@ void Warp::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::
 	h.append( sampleRegionsHash );
 
 	const Box2i &tileInputBound = sampleRegions->member< Box2iData >( g_tileInputBoundName, true )->readable();
+	const std::vector<V2i> &inputTileOrigins = sampleRegions->member< V2iVectorData >( g_inputTileOriginsName, true )->readable();
 
 	Sampler sampler(
 		inPlug(),
@@ -630,7 +704,7 @@ void Warp::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::
 		tileInputBound,
 		(Sampler::BoundingMode)boundingModePlug()->getValue()
 	);
-	sampler.hash( h );
+	sampler.hash( h, inputTileOrigins );
 
 	{
 		ImagePlug::GlobalScope c( context );
@@ -655,7 +729,7 @@ IECore::ConstFloatVectorDataPtr Warp::computeChannelData( const std::string &cha
 
 	FloatVectorDataPtr resultData = new FloatVectorData;
 	vector<float> &result = resultData->writable();
-	result.reserve( ImagePlug::tileSize() * ImagePlug::tileSize() );
+	result.resize( ImagePlug::tilePixels(), 0.0f );
 
 	std::string filterName = filterPlug()->getValue();
 	const OIIO::Filter2D *filter = nullptr;
@@ -684,30 +758,68 @@ IECore::ConstFloatVectorDataPtr Warp::computeChannelData( const std::string &cha
 		(Sampler::BoundingMode)boundingModePlug()->getValue()
 	);
 
-	std::vector<float> scratchMemory;
+	// Build a sampling plan, grouping the pixels to be sampled by the input tile
+	// containing their source position. Visiting the pixels in this order means
+	// we work through one input tile at a time, which is much more cache friendly
+	// than visiting them in output order when the displacements are large.
+
+	const V2i minTile = ImagePlug::tileOrigin( tileInputBound.min );
+	const V2i maxTile = ImagePlug::tileOrigin( tileInputBound.max - V2i( 1 ) );
+	const int numTilesX = ( maxTile.x - minTile.x ) / ImagePlug::tileSize() + 1;
+	const int numTilesY = ( maxTile.y - minTile.y ) / ImagePlug::tileSize() + 1;
+
+	std::vector<int> pixelTiles( ImagePlug::tilePixels(), -1 );
+	std::vector<int> tileOffsets( numTilesX * numTilesY + 1, 0 );
 	int i = 0;
 	V2i oP;
 	for( oP.y = 0; oP.y < ImagePlug::tileSize(); ++oP.y )
 	{
 		for( oP.x = 0; oP.x < ImagePlug::tileSize(); ++oP.x, ++i )
 		{
-			float v = 0;
-			if( BufferAlgo::contains( validPixelsRelativeToTile , oP ) )
+			const V2f &input = pixelInputPositions[i];
+			if( input == Engine::black || !BufferAlgo::contains( validPixelsRelativeToTile , oP ) )
 			{
-				const V2f &input = pixelInputPositions[i];
-				if( input != Engine::black )
-				{
-					if( filter )
-					{
-						v = FilterAlgo::sampleBox( sampler, input, pixelInputDerivatives[i].x, pixelInputDerivatives[i].y, filter, scratchMemory );
-					}
-					else
-					{
-						v = sampler.sample( input.x, input.y );
-					}
-				}
+				continue;
 			}
-			result.push_back( v );
+			const V2i inputTile = ImagePlug::tileOrigin( V2i( (int)floorf( input.x ), (int)floorf( input.y ) ) );
+			const V2i t(
+				std::clamp( ( inputTile.x - minTile.x ) / ImagePlug::tileSize(), 0, numTilesX - 1 ),
+				std::clamp( ( inputTile.y - minTile.y ) / ImagePlug::tileSize(), 0, numTilesY - 1 )
+			);
+			pixelTiles[i] = t.y * numTilesX + t.x;
+			tileOffsets[pixelTiles[i] + 1]++;
+		}
+	}
+
+	for( size_t t = 1; t < tileOffsets.size(); ++t )
+	{
+		tileOffsets[t] += tileOffsets[t-1];
+	}
+
+	std::vector<int> plan( tileOffsets.back() );
+	for( i = 0; i < ImagePlug::tilePixels(); ++i )
+	{
+		if( pixelTiles[i] >= 0 )
+		{
+			plan[tileOffsets[pixelTiles[i]]++] = i;
+		}
+	}
+
+	// Execute the plan.
+
+	std::vector<float> scratchMemory;
+	if( filter )
+	{
+		for( int p : plan )
+		{
+			result[p] = FilterAlgo::sampleBox( sampler, pixelInputPositions[p], pixelInputDerivatives[p].x, pixelInputDerivatives[p].y, filter, scratchMemory );
+		}
+	}
+	else
+	{
+		for( int p : plan )
+		{
+			result[p] = sampler.sample( pixelInputPositions[p].x, pixelInputPositions[p].y );
 		}
 	}
 
@@ -306,46 +306,55 @@ class FormatPlugSerialiser : public GafferBindings::ValuePlugSerialiser
 void GafferImageModule::bindCore()
 {
 
-	PlugClass<ImagePlug>()
-		.def(
-			init< const std::string &, Gaffer::Plug::Direction, unsigned >
-			(
+	{
+		scope imagePlugScope = PlugClass<ImagePlug>()
+			.def(
+				init< const std::string &, Gaffer::Plug::Direction, unsigned >
 				(
-					arg( "name" ) = Gaffer::GraphComponent::defaultName<ImagePlug>(),
-					arg( "direction" ) = Gaffer::Plug::In,
-					arg( "flags" ) = Gaffer::Plug::Default
+					(
+						arg( "name" ) = Gaffer::GraphComponent::defaultName<ImagePlug>(),
+						arg( "direction" ) = Gaffer::Plug::In,
+						arg( "flags" ) = Gaffer::Plug::Default
+					)
 				)
 			)
-		)
-		.def( "channelData", &channelData, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
-		.def( "channelDataHash", &channelDataHash, ( arg( "viewName" ) = object() ) )
-		.def( "viewNames", &viewNames, ( arg( "_copy" ) = true ) )
-		.def( "viewNamesHash", &viewNamesHash )
-		.def( "format", &format, ( arg( "viewName" ) = object() ) )
-		.def( "formatHash", &formatHash, ( arg( "viewName" ) = object() ) )
-		.def( "dataWindow", &dataWindow, ( arg( "viewName" ) = object() ) )
-		.def( "dataWindowHash", &dataWindowHash, ( arg( "viewName" ) = object() ) )
-		.def( "channelNames", &channelNames, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
-		.def( "channelNamesHash", &channelNamesHash, ( arg( "viewName" ) = object() ) )
-		.def( "metadata", &metadata, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
-		.def( "metadataHash", &metadataHash, ( arg( "viewName" ) = object() ) )
-		.def( "deep", &deep, ( arg( "viewName" ) = object() ) )
-		.def( "deepHash", &deepHash, ( arg( "viewName" ) = object() ) )
-		.def( "sampleOffsets", &sampleOffsets, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
-		.def( "sampleOffsetsHash", &sampleOffsetsHash, ( arg( "viewName" ) = object() ) )
-		.def( "tileSize", &ImagePlug::tileSize ).staticmethod( "tileSize" )
-		.def( "tilePixels", &ImagePlug::tilePixels ).staticmethod( "tilePixels" )
-		.def( "tileIndex", &ImagePlug::tileIndex ).staticmethod( "tileIndex" )
-		.def( "tileOrigin", &ImagePlug::tileOrigin ).staticmethod( "tileOrigin" )
-		.def( "pixelIndex", &ImagePlug::pixelIndex ).staticmethod( "pixelIndex" )
-		.add_static_property( "defaultViewName", &defaultViewName )
-		.def( "defaultViewNames", &defaultViewNames, ( arg( "_copy" ) = true ) ).staticmethod( "defaultViewNames" )
-		.def( "emptyTileSampleOffsets", &emptyTileSampleOffsets, ( arg( "_copy" ) = true ) ).staticmethod( "emptyTileSampleOffsets" )
-		.def( "flatTileSampleOffsets", &flatTileSampleOffsets, ( arg( "_copy" ) = true ) ).staticmethod( "flatTileSampleOffsets" )
-		.def( "emptyTile", &emptyTile, ( arg( "_copy" ) = true ) ).staticmethod( "emptyTile" )
-		.def( "blackTile", &blackTile, ( arg( "_copy" ) = true ) ).staticmethod( "blackTile" )
-		.def( "whiteTile", &whiteTile, ( arg( "_copy" ) = true ) ).staticmethod( "whiteTile" )
-	;
+			.def( "channelData", &channelData, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
+			.def( "channelDataHash", &channelDataHash, ( arg( "viewName" ) = object() ) )
+			.def( "viewNames", &viewNames, ( arg( "_copy" ) = true ) )
+			.def( "viewNamesHash", &viewNamesHash )
+			.def( "format", &format, ( arg( "viewName" ) = object() ) )
+			.def( "formatHash", &formatHash, ( arg( "viewName" ) = object() ) )
+			.def( "dataWindow", &dataWindow, ( arg( "viewName" ) = object() ) )
+			.def( "dataWindowHash", &dataWindowHash, ( arg( "viewName" ) = object() ) )
+			.def( "channelNames", &channelNames, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
+			.def( "channelNamesHash", &channelNamesHash, ( arg( "viewName" ) = object() ) )
+			.def( "metadata", &metadata, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
+			.def( "metadataHash", &metadataHash, ( arg( "viewName" ) = object() ) )
+			.def( "deep", &deep, ( arg( "viewName" ) = object() ) )
+			.def( "deepHash", &deepHash, ( arg( "viewName" ) = object() ) )
+			.def( "sampleOffsets", &sampleOffsets, ( arg( "viewName" ) = object(), arg( "_copy" ) = true ) )
+			.def( "sampleOffsetsHash", &sampleOffsetsHash, ( arg( "viewName" ) = object() ) )
+			.def( "tileSize", &ImagePlug::tileSize ).staticmethod( "tileSize" )
+			.def( "tilePixels", &ImagePlug::tilePixels ).staticmethod( "tilePixels" )
+			.def( "tileIndex", &ImagePlug::tileIndex ).staticmethod( "tileIndex" )
+			.def( "tileOrigin", &ImagePlug::tileOrigin ).staticmethod( "tileOrigin" )
+			.def( "pixelIndex", &ImagePlug::pixelIndex ).staticmethod( "pixelIndex" )
+			.add_static_property( "defaultViewName", &defaultViewName )
+			.def( "defaultViewNames", &defaultViewNames, ( arg( "_copy" ) = true ) ).staticmethod( "defaultViewNames" )
+			.def( "emptyTileSampleOffsets", &emptyTileSampleOffsets, ( arg( "_copy" ) = true ) ).staticmethod( "emptyTileSampleOffsets" )
+			.def( "flatTileSampleOffsets", &flatTileSampleOffsets, ( arg( "_copy" ) = true ) ).staticmethod( "flatTileSampleOffsets" )
+			.def( "emptyTile", &emptyTile, ( arg( "_copy" ) = true ) ).staticmethod( "emptyTile" )
+			.def( "blackTile", &blackTile, ( arg( "_copy" ) = true ) ).staticmethod( "blackTile" )
+			.def( "whiteTile", &whiteTile, ( arg( "_copy" ) = true ) ).staticmethod( "whiteTile" )
+			.def( "tileSampleLayout", &ImagePlug::tileSampleLayout ).staticmethod( "tileSampleLayout" )
+		;
+
+		enum_<ImagePlug::TileSampleLayout>( "TileSampleLayout" )
+			.value( "Empty", ImagePlug::TileSampleLayout::Empty )
+			.value( "Flat", ImagePlug::TileSampleLayout::Flat )
+			.value( "General", ImagePlug::TileSampleLayout::General )
+		;
+	}
 
 	using ImageNodeWrapper = ComputeNodeWrapper<ImageNode>;
 	GafferBindings::DependencyNodeClass<ImageNode, ImageNodeWrapper>();
@@ -119,7 +119,7 @@ void deleteWithGIL( object *o )
 	delete o;
 }
 
-void parallelGatherTiles1( const GafferImage::ImagePlug &image, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder )
+void parallelGatherTiles1( const GafferImage::ImagePlug &image, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder, size_t maxPendingTiles )
 {
 	IECorePython::ScopedGILRelease gilRelease;
 	ImageAlgo::parallelGatherTiles(
@@ -140,12 +140,13 @@ void parallelGatherTiles1( const GafferImage::ImagePlug &image, object pythonTil
 		},
 
 		window,
-		tileOrder
+		tileOrder,
+		maxPendingTiles
 
 	);
 }
 
-void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonChannelNames, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder )
+void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonChannelNames, object pythonTileFunctor, object pythonGatherFunctor, const Imath::Box2i &window, ImageAlgo::TileOrder tileOrder, size_t maxPendingTiles )
 {
 	vector<string> channelNames;
 	boost::python::container_utils::extend_container( channelNames, pythonChannelNames );
@@ -169,7 +170,8 @@ void parallelGatherTiles2( const GafferImage::ImagePlug &image, object pythonCha
 		},
 
 		window,
-		tileOrder
+		tileOrder,
+		maxPendingTiles
 
 	);
 }
@@ -227,7 +229,8 @@ void GafferImageModule::bindImageAlgo()
 			boost::python::arg( "tileFunctor" ),
 			boost::python::arg( "gatherFunctor" ),
 			boost::python::arg( "window" ) = Imath::Box2i(),
-			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered
+			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered,
+			boost::python::arg( "maxPendingTiles" ) = 0
 		)
 	);
 
@@ -239,7 +242,8 @@ void GafferImageModule::bindImageAlgo()
 			boost::python::arg( "tileFunctor" ),
 			boost::python::arg( "gatherFunctor" ),
 			boost::python::arg( "window" ) = Imath::Box2i(),
-			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered
+			boost::python::arg( "tileOrder" ) = ImageAlgo::Unordered,
+			boost::python::arg( "maxPendingTiles" ) = 0
 		)
 	);
 
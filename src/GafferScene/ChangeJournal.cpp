@@ -0,0 +1,307 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/ChangeJournal.h"
+
+#include "GafferScene/Attributes.h"
+#include "GafferScene/Isolate.h"
+#include "GafferScene/PathFilter.h"
+#include "GafferScene/Prune.h"
+#include "GafferScene/ScenePlug.h"
+#include "GafferScene/ShaderTweaks.h"
+#include "GafferScene/Transform.h"
+
+#include "Gaffer/PlugAlgo.h"
+
+#include "boost/bind/bind.hpp"
+
+using namespace std;
+using namespace boost::placeholders;
+using namespace IECore;
+using namespace Gaffer;
+using namespace GafferScene;
+using namespace GafferScene::Private;
+
+//////////////////////////////////////////////////////////////////////////
+// Internal utilities
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+bool isOrIsAncestorOf( const Plug *ancestor, const Plug *plug )
+{
+	return plug == ancestor || ancestor->isAncestorOf( plug );
+}
+
+// Returns true if edits to `plug` only affect the locations
+// matched by the filter of `processor`.
+using ConfinedToFilterFunction = bool (*)( const FilteredSceneProcessor *processor, const Plug *plug );
+
+bool neverConfinedToFilter( const FilteredSceneProcessor *processor, const Plug *plug )
+{
+	return false;
+}
+
+bool attributesConfinedToFilter( const FilteredSceneProcessor *processor, const Plug *plug )
+{
+	auto attributes = static_cast<const Attributes *>( processor );
+	return
+		isOrIsAncestorOf( attributes->attributesPlug(), plug ) ||
+		plug == attributes->extraAttributesPlug()
+	;
+}
+
+// Processors which output changes to the input scene at the same
+// locations they were made at, without affecting any others. The
+// ShaderTweaks and Transform nodes also modify only the locations
+// matched by their filter, as do Attributes nodes (see below).
+const std::unordered_map<IECore::TypeId, ConfinedToFilterFunction> &processorFunctions()
+{
+	static const std::unordered_map<IECore::TypeId, ConfinedToFilterFunction> g_functions = {
+		{
+			(IECore::TypeId)ShaderTweaksTypeId,
+			[] ( const FilteredSceneProcessor *processor, const Plug *plug ) {
+				auto shaderTweaks = static_cast<const ShaderTweaks *>( processor );
+				return
+					plug == shaderTweaks->shaderPlug() ||
+					plug == shaderTweaks->ignoreMissingPlug() ||
+					isOrIsAncestorOf( shaderTweaks->tweaksPlug(), plug ) ||
+					plug == shaderTweaks->localisePlug()
+				;
+			}
+		},
+		{
+			(IECore::TypeId)TransformTypeId,
+			[] ( const FilteredSceneProcessor *processor, const Plug *plug ) {
+				auto transform = static_cast<const Transform *>( processor );
+				return
+					plug == transform->spacePlug() ||
+					isOrIsAncestorOf( transform->transformPlug(), plug )
+				;
+			}
+		},
+		{ (IECore::TypeId)IsolateTypeId, neverConfinedToFilter },
+		{ (IECore::TypeId)PruneTypeId, neverConfinedToFilter },
+	};
+	return g_functions;
+}
+
+ConfinedToFilterFunction processorFunction( const FilteredSceneProcessor *processor )
+{
+	const auto &functions = processorFunctions();
+	auto it = functions.find( processor->typeId() );
+	if( it != functions.end() )
+	{
+		return it->second;
+	}
+
+	// Derived classes such as StandardAttributes and CustomAttributes
+	// only add to the `attributes` plug, so we can treat them all the same.
+	if( runTimeCast<const Attributes>( processor ) )
+	{
+		return attributesConfinedToFilter;
+	}
+
+	return nullptr;
+}
+
+// Returns the paths matched by the filter of `processor`, provided
+// they are known without computation.
+std::optional<PathMatcher> staticFilterPaths( const FilteredSceneProcessor *processor )
+{
+	auto pathFilter = runTimeCast<const PathFilter>( processor->filterPlug()->source()->node() );
+	if( !pathFilter || pathFilter->rootsPlug()->getInput() || PlugAlgo::dependsOnCompute( pathFilter->pathsPlug() ) )
+	{
+		return std::nullopt;
+	}
+
+	ConstStringVectorDataPtr paths = pathFilter->pathsPlug()->getValue();
+	return PathMatcher( paths->readable().begin(), paths->readable().end() );
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// ChangeJournal
+//////////////////////////////////////////////////////////////////////////
+
+ChangeJournal::ChangeJournal()
+{
+}
+
+ChangeJournal::~ChangeJournal()
+{
+}
+
+std::optional<IECore::PathMatcher> ChangeJournal::affectedPaths( const Gaffer::ValuePlug *plug )
+{
+	const InternedString name = plug->getName();
+
+	PathMatcher result;
+	bool known = true;
+	while( true )
+	{
+		plug = plug->source<ValuePlug>();
+
+		auto scene = plug->parent<ScenePlug>();
+		auto processor = scene ? runTimeCast<const FilteredSceneProcessor>( scene->node() ) : nullptr;
+		if( !processor || scene != processor->outPlug() || !processorFunction( processor ) )
+		{
+			// We don't know how changes to this plug map to locations, so
+			// can only account for the dirtying if it didn't come from here.
+			known = sourceUnchanged( plug ) && known;
+			break;
+		}
+
+		auto [it, inserted] = m_processors.try_emplace( processor );
+		ProcessorEntry &entry = it->second;
+		if( inserted )
+		{
+			// We weren't tracking edits before now, so can't account
+			// for any that have already been made.
+			entry.node = processor;
+			entry.plugDirtiedConnection = const_cast<FilteredSceneProcessor *>( processor )->plugDirtiedSignal().connect(
+				boost::bind( &ChangeJournal::plugDirtied, this, ::_1, boost::ref( entry ) )
+			);
+			entry.unknownPaths = true;
+		}
+
+		if( entry.unknownPaths )
+		{
+			known = false;
+		}
+		else if( known )
+		{
+			result.addPaths( entry.paths );
+		}
+
+		// Continue upstream, to account for any changes that
+		// were passed through.
+		plug = processor->inPlug()->getChild<ValuePlug>( name );
+	}
+
+	if( !known )
+	{
+		return std::nullopt;
+	}
+
+	return result;
+}
+
+void ChangeJournal::clear()
+{
+	for( auto it = m_processors.begin(); it != m_processors.end(); )
+	{
+		if( !it->second.node->parent() )
+		{
+			// Node has been removed from the graph.
+			it = m_processors.erase( it );
+		}
+		else
+		{
+			it->second.paths = PathMatcher();
+			it->second.unknownPaths = false;
+			++it;
+		}
+	}
+
+	for( auto it = m_sources.begin(); it != m_sources.end(); )
+	{
+		const Node *node = it->second.plug->node();
+		if( !node || !node->parent() )
+		{
+			it = m_sources.erase( it );
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+void ChangeJournal::plugDirtied( const Gaffer::Plug *plug, ProcessorEntry &entry )
+{
+	if( entry.unknownPaths )
+	{
+		return;
+	}
+
+	auto processor = static_cast<const FilteredSceneProcessor *>( entry.node.get() );
+	if( processor->inPlug()->isAncestorOf( plug ) || processor->outPlug()->isAncestorOf( plug ) )
+	{
+		// Changes to the input are accounted for by continuing
+		// the search upstream in `affectedPaths()`.
+		return;
+	}
+
+	DependencyNode::AffectedPlugsContainer affected;
+	processor->affects( plug, affected );
+	if( affected.empty() )
+	{
+		// Plugs such as `user` plugs, and parents of compound plugs,
+		// don't affect the output directly.
+		return;
+	}
+
+	if( processorFunction( processor )( processor, plug ) )
+	{
+		if( auto paths = staticFilterPaths( processor ) )
+		{
+			entry.paths.addPaths( *paths );
+			return;
+		}
+	}
+
+	entry.unknownPaths = true;
+}
+
+bool ChangeJournal::sourceUnchanged( const Gaffer::ValuePlug *plug )
+{
+	auto [it, inserted] = m_sources.try_emplace( plug );
+	SourceEntry &entry = it->second;
+	const uint64_t dirtyCount = plug->dirtyCount();
+	if( inserted )
+	{
+		entry.plug = plug;
+		entry.dirtyCount = dirtyCount;
+		return false;
+	}
+
+	const bool unchanged = entry.dirtyCount == dirtyCount;
+	entry.dirtyCount = dirtyCount;
+	return unchanged;
+}
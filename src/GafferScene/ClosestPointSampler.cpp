@@ -100,3 +100,20 @@ PrimitiveSampler::SamplingFunction ClosestPointSampler::computeSamplingFunction(
 		return evaluator.closestPoint( positionView[index] * transform, &result );
 	};
 }
+
+void ClosestPointSampler::computeSamplingOrder( const IECoreScene::Primitive *destinationPrimitive, IECoreScene::PrimitiveVariable::Interpolation interpolation, std::vector<size_t> &order ) const
+{
+	auto it = destinationPrimitive->variables.find( positionPlug()->getValue() );
+	if( it == destinationPrimitive->variables.end() )
+	{
+		return;
+	}
+
+	PrimitiveVariable::IndexedView<V3f> positionView( it->second );
+	std::vector<V3f> positions( positionView.size() );
+	for( size_t i = 0; i < positions.size(); ++i )
+	{
+		positions[i] = positionView[i];
+	}
+	spatialOrder( positions, order );
+}
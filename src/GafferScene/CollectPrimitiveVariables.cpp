@@ -38,6 +38,8 @@
 
 #include "GafferScene/CollectPrimitiveVariables.h"
 
+#include "GafferScene/Private/PrimitiveAlgo.h"
+
 #include "Gaffer/ArrayPlug.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
@@ -212,7 +214,7 @@ IECore::ConstObjectPtr CollectPrimitiveVariables::computeProcessedObject( const
 		}
 	}
 
-	IECoreScene::PrimitivePtr result = inPrimitive->copy();
+	IECoreScene::PrimitivePtr result = Private::PrimitiveAlgo::copyWithSharedVariables( inPrimitive );
 	for( unsigned int i = 0; i < suffixes.size(); i++ )
 	{
 		const IECoreScene::Primitive* collectPrimitive = runTimeCast<const IECoreScene::Primitive>( collectedObjects[i].get() );
@@ -36,6 +36,7 @@
 
 #include "GafferScene/CopyPrimitiveVariables.h"
 
+#include "GafferScene/Private/PrimitiveAlgo.h"
 #include "GafferScene/SceneAlgo.h"
 
 #include "Gaffer/ArrayPlug.h"
@@ -208,7 +209,7 @@ IECore::ConstObjectPtr CopyPrimitiveVariables::computeProcessedObject( const Sce
 
 	bool ignoreIncompatible = ignoreIncompatiblePlug()->getValue();
 
-	PrimitivePtr result = primitive->copy();
+	PrimitivePtr result = Private::PrimitiveAlgo::copyWithSharedVariables( primitive );
 	for( auto &variable : sourcePrimitive->variables )
 	{
 		if( !StringAlgo::matchMultiple( variable.first, primitiveVariables ) )
@@ -61,6 +61,8 @@
 #include "IECoreGL/ToGLCameraConverter.h"
 #include "IECoreGL/IECoreGL.h"
 
+#include "IECoreScene/Primitive.h"
+
 #include "IECore/CompoundParameter.h"
 #include "IECore/MessageHandler.h"
 #include "IECore/PathMatcherData.h"
@@ -80,10 +82,16 @@
 #include "boost/algorithm/string/predicate.hpp"
 
 #include "tbb/concurrent_queue.h"
+#include "tbb/task_arena.h"
 
 #include "fmt/format.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -472,7 +480,9 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 
 	public :
 
-		OpenGLObject( const std::string &name, const IECore::Object *object, const ConstOpenGLAttributesPtr &attributes, EditQueue &editQueue )
+		// If `deferConversion` is true, then `object` is not converted, and
+		// its bound is drawn instead until `setRenderable()` is called.
+		OpenGLObject( const std::string &name, const IECore::Object *object, const ConstOpenGLAttributesPtr &attributes, EditQueue &editQueue, bool deferConversion = false )
 			:	m_objectType( object ? object->typeId() : IECore::NullObjectTypeId ),
 				m_attributes( attributes ),
 				m_editQueue( editQueue )
@@ -486,6 +496,13 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 					m_objectVisualisations = visualiser->visualise( object );
 					m_renderable = nullptr;
 				}
+				else if( deferConversion )
+				{
+					IECoreScenePreview::ConstPlaceholderPtr placeholder = new IECoreScenePreview::Placeholder(
+						static_cast<const IECoreScene::VisibleRenderable *>( object )->bound()
+					);
+					m_objectVisualisations = ObjectVisualiser::acquire( placeholder->typeId() )->visualise( placeholder.get() );
+				}
 				else
 				{
 					try
@@ -514,6 +531,14 @@ class OpenGLObject : public IECoreScenePreview::Renderer::ObjectInterface
 			transform( samples.front() );
 		}
 
+		// Replaces the bound drawn for a deferred conversion.
+		// Must be called on the render thread.
+		void setRenderable( const IECoreGL::ConstRenderablePtr &renderable )
+		{
+			m_renderable = renderable;
+			m_objectVisualisations.clear();
+		}
+
 		bool attributes( const IECoreScenePreview::Renderer::AttributesInterface *attributes ) override
 		{
 			ConstOpenGLAttributesPtr openGLAttributes = static_cast<const OpenGLAttributes *>( attributes );
@@ -829,7 +854,10 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 
 		OpenGLRenderer( RenderType renderType, const std::string &fileName, const IECore::MessageHandlerPtr &messageHandler )
 			:	m_renderType( renderType ), m_baseStateOptions( new CompoundObject ),
-				m_renderObjects( true ), m_messageHandler( messageHandler )
+				m_renderObjects( true ), m_backgroundConversionThreshold( 100000 ),
+				m_messageHandler( messageHandler ),
+				m_conversionArena( std::max( 1, tbb::this_task_arena::max_concurrency() / 2 ) ),
+				m_pendingConversions( 0 )
 		{
 			if( renderType == SceneDescription )
 			{
@@ -839,6 +867,9 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 
 		~OpenGLRenderer() override
 		{
+			// Conversions reference `m_editQueue`, so must
+			// be complete before we are destroyed.
+			waitForConversions();
 		}
 
 		IECore::InternedString name() const override
@@ -888,6 +919,10 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			{
 				m_renderObjects = ::option<bool>( value, name, true );
 			}
+			else if( name == "gl:backgroundConversionThreshold" )
+			{
+				m_backgroundConversionThreshold = ::option<int>( value, name, 100000 );
+			}
 			else if( boost::contains( name.string(), ":" ) && !boost::starts_with( name.string(), "gl:" ) )
 			{
 				// Ignore options prefixed for some other renderer.
@@ -958,8 +993,13 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 
 			IECore::MessageHandler::Scope s( m_messageHandler.get() );
 
-			OpenGLObjectPtr result = new OpenGLObject( name, object, static_cast<const OpenGLAttributes *>( attributes ), m_editQueue );
+			const bool convertInBackground = shouldConvertInBackground( object );
+			OpenGLObjectPtr result = new OpenGLObject( name, object, static_cast<const OpenGLAttributes *>( attributes ), m_editQueue, convertInBackground );
 			m_editQueue.push( [this, result]() { m_objects.push_back( result ); } );
+			if( convertInBackground )
+			{
+				this->convertInBackground( result, object );
+			}
 			return result;
 		}
 
@@ -1014,6 +1054,10 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 				renderToCurrentContext( parameters );
 				return nullptr;
 			}
+			else if( name == "gl:waitForConversions" )
+			{
+				return new BoolData( waitForConversions( parameter<float>( parameters, "timeout", -1.0f ) ) );
+			}
 			else if( boost::starts_with( name.string(), "gl:" ) || name.string().find( ":" ) == string::npos )
 			{
 				IECore::msg( IECore::Msg::Warning, "IECoreGL::Renderer::command", fmt::format( "Unknown command \"{}\".", name.string() ) );
@@ -1082,6 +1126,9 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 		{
 			IECoreGL::init();
 
+			// Batch renders never convert in the background (see
+			// `shouldConvertInBackground()`), so there are no
+			// conversions to wait for.
 			processQueue();
 			CachedConverter::defaultCachedConverter()->clearUnused();
 
@@ -1140,6 +1187,80 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 			glUseProgram( prevProgram );
 		}
 
+		// Large primitives are converted to IECoreGL on background threads,
+		// so that `object()` returns without waiting for triangulation,
+		// normal generation and so on. In the meantime, the bound of the
+		// primitive is drawn in its place.
+		bool shouldConvertInBackground( const IECore::Object *object ) const
+		{
+			if( m_backgroundConversionThreshold <= 0 || m_renderType != Interactive )
+			{
+				return false;
+			}
+
+			auto primitive = runTimeCast<const IECoreScene::Primitive>( object );
+			return
+				primitive &&
+				primitive->variableSize( IECoreScene::PrimitiveVariable::Vertex ) >= (size_t)m_backgroundConversionThreshold &&
+				!ObjectVisualiser::acquire( primitive->typeId() )
+			;
+		}
+
+		void convertInBackground( const OpenGLObjectPtr &glObject, const IECore::Object *object )
+		{
+			++m_pendingConversions;
+
+			// Conversions run in a dedicated arena with limited concurrency,
+			// so that they don't starve the RenderController of the threads
+			// it needs to generate the rest of the scene.
+			m_conversionArena.enqueue(
+				[this, glObject, object = ConstObjectPtr( object )] () mutable {
+					IECoreGL::ConstRenderablePtr renderable;
+					try
+					{
+						IECore::MessageHandler::Scope s( m_messageHandler.get() );
+						renderable = runTimeCast<const IECoreGL::Renderable>(
+							CachedConverter::defaultCachedConverter()->convert( object.get() )
+						);
+					}
+					catch( ... )
+					{
+						// Leave renderable as null, as we would for a
+						// failed conversion in the OpenGLObject constructor.
+					}
+
+					// Give our references to the edit, so that GL resources are
+					// only ever released on the render thread.
+					m_editQueue.push(
+						[glObject = std::move( glObject ), renderable = std::move( renderable )]() {
+							glObject->setRenderable( renderable );
+						}
+					);
+
+					std::lock_guard<std::mutex> lock( m_conversionsMutex );
+					if( --m_pendingConversions == 0 )
+					{
+						m_conversionsCondition.notify_all();
+					}
+				}
+			);
+		}
+
+		// Waits for pending conversions, for at most `timeout` seconds
+		// if it is non-negative. Returns true if all conversions are
+		// complete.
+		bool waitForConversions( float timeout = -1.0f )
+		{
+			std::unique_lock<std::mutex> lock( m_conversionsMutex );
+			auto complete = [this] { return m_pendingConversions == 0; };
+			if( timeout < 0.0f )
+			{
+				m_conversionsCondition.wait( lock, complete );
+				return true;
+			}
+			return m_conversionsCondition.wait_for( lock, std::chrono::duration<float>( timeout ), complete );
+		}
+
 		void processQueue()
 		{
 			Edit edit;
@@ -1342,12 +1463,20 @@ class OpenGLRenderer final : public IECoreScenePreview::Renderer
 		IECore::CompoundObjectPtr m_baseStateOptions;
 		IECoreGL::StatePtr m_baseState;
 		bool m_renderObjects;
+		int m_backgroundConversionThreshold;
 
 		IECore::MessageHandlerPtr m_messageHandler;
 
 		// Queue used to pass edits from background threads to the render thread.
 		EditQueue m_editQueue;
 
+		// Background conversions. Completed conversions are applied
+		// to their objects via `m_editQueue`.
+		tbb::task_arena m_conversionArena;
+		std::atomic<size_t> m_pendingConversions;
+		std::mutex m_conversionsMutex;
+		std::condition_variable m_conversionsCondition;
+
 		// Render state. Updated on the render thread by processing Edits
 		// from m_editQueue.
 
@@ -0,0 +1,164 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//     * Redistributions of source code must retain the above copyright
+//       notice, this list of conditions and the following disclaimer.
+//
+//     * Redistributions in binary form must reproduce the above copyright
+//       notice, this list of conditions and the following disclaimer in the
+//       documentation and/or other materials provided with the distribution.
+//
+//     * Neither the name of Image Engine Design nor the names of any
+//       other contributors to this software may be used to endorse or
+//       promote products derived from this software without specific prior
+//       written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/IECoreScenePreview/AttributesCache.h"
+
+#include <vector>
+
+using namespace std;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace IECoreScenePreview;
+
+AttributesCache::AttributesCache( Renderer *renderer )
+	:	m_renderer( renderer ), m_attributesHits( 0 ), m_attributesMisses( 0 ), m_shaderHits( 0 ), m_shaderMisses( 0 )
+{
+}
+
+AttributesCache::~AttributesCache()
+{
+}
+
+Renderer::AttributesInterfacePtr AttributesCache::get( const IECore::CompoundObject *attributes )
+{
+	const IECore::MurmurHash h = attributes->Object::hash();
+
+	AttributesMap::const_accessor readAccessor;
+	if( m_attributes.find( readAccessor, h ) )
+	{
+		m_attributesHits++;
+		return readAccessor->second;
+	}
+	readAccessor.release();
+
+	// Create the attributes without holding a lock, since renderers
+	// may spawn TBB tasks from `attributes()`. If another thread creates
+	// the same attributes concurrently, we use whichever is inserted
+	// first, so that all locations share a single instance.
+
+	m_attributesMisses++;
+	ConstCompoundObjectPtr internedAttributes = internShaders( attributes );
+	Renderer::AttributesInterfacePtr result = m_renderer->attributes( internedAttributes.get() );
+
+	AttributesMap::const_accessor insertAccessor;
+	m_attributes.insert( insertAccessor, AttributesMap::value_type( h, result ) );
+	return insertAccessor->second;
+}
+
+void AttributesCache::clearUnused()
+{
+	vector<IECore::MurmurHash> toErase;
+	for( const auto &a : m_attributes )
+	{
+		if( a.second->refCount() == 1 )
+		{
+			// Only one reference - this is ours, so nothing outside
+			// of the cache is using the attributes.
+			toErase.push_back( a.first );
+		}
+	}
+	for( const auto &h : toErase )
+	{
+		m_attributes.erase( h );
+	}
+
+	toErase.clear();
+	for( const auto &s : m_shaders )
+	{
+		if( s.second->refCount() == 1 )
+		{
+			toErase.push_back( s.first );
+		}
+	}
+	for( const auto &h : toErase )
+	{
+		m_shaders.erase( h );
+	}
+}
+
+AttributesCache::Statistics AttributesCache::statistics() const
+{
+	Statistics result;
+	result.attributesHits = m_attributesHits;
+	result.attributesMisses = m_attributesMisses;
+	result.shaderHits = m_shaderHits;
+	result.shaderMisses = m_shaderMisses;
+	return result;
+}
+
+IECore::ConstCompoundObjectPtr AttributesCache::internShaders( const IECore::CompoundObject *attributes )
+{
+	CompoundObjectPtr result;
+	for( const auto &[name, value] : attributes->members() )
+	{
+		const ShaderNetwork *shaderNetwork = runTimeCast<const ShaderNetwork>( value.get() );
+		if( !shaderNetwork )
+		{
+			continue;
+		}
+
+		ConstShaderNetworkPtr internedShaderNetwork;
+		{
+			ShaderMap::accessor a;
+			if( m_shaders.insert( a, shaderNetwork->Object::hash() ) )
+			{
+				m_shaderMisses++;
+				a->second = shaderNetwork;
+			}
+			else
+			{
+				m_shaderHits++;
+			}
+			internedShaderNetwork = a->second;
+		}
+
+		if( internedShaderNetwork != shaderNetwork )
+		{
+			if( !result )
+			{
+				// Shallow copy, so that we share all the
+				// members we aren't replacing.
+				result = new CompoundObject;
+				result->members() = attributes->members();
+			}
+			result->members()[name] = boost::const_pointer_cast<ShaderNetwork>( internedShaderNetwork );
+		}
+	}
+
+	if( result )
+	{
+		return result;
+	}
+	return attributes;
+}
@@ -52,7 +52,7 @@ using namespace IECoreScenePreview;
 IECoreScenePreview::Renderer::TypeDescription<CapturingRenderer> CapturingRenderer::g_typeDescription( "Capturing" );
 
 CapturingRenderer::CapturingRenderer( RenderType type, const std::string &fileName, const IECore::MessageHandlerPtr &messageHandler )
-	:	m_messageHandler( messageHandler ), m_renderType( type ), m_rendering( false )
+	:	m_messageHandler( messageHandler ), m_renderType( type ), m_rendering( false ), m_hashOnly( false ), m_numInstanceBatches( 0 )
 {
 }
 
@@ -83,7 +83,7 @@ std::vector< std::string > CapturingRenderer::capturedObjectNames() const
 
 const CapturingRenderer::CapturedObject *CapturingRenderer::capturedObject( const std::string &name ) const
 {
-	ObjectMap::accessor a;
+	ObjectMap::const_accessor a;
 	if( m_capturedObjects.find( a, name ) )
 	{
 		return a->second;
@@ -92,6 +92,25 @@ const CapturingRenderer::CapturedObject *CapturingRenderer::capturedObject( cons
 	return nullptr;
 }
 
+size_t CapturingRenderer::numInstanceBatches() const
+{
+	return m_numInstanceBatches;
+}
+
+CapturingRenderer::Statistics CapturingRenderer::statistics() const
+{
+	Statistics result;
+	result.attributes = m_statistics.attributes;
+	result.cameras = m_statistics.cameras;
+	result.lights = m_statistics.lights;
+	result.lightFilters = m_statistics.lightFilters;
+	result.objects = m_statistics.objects;
+	result.transformEdits = m_statistics.transformEdits;
+	result.attributeEdits = m_statistics.attributeEdits;
+	result.linkEdits = m_statistics.linkEdits;
+	return result;
+}
+
 IECore::InternedString CapturingRenderer::name() const
 {
 	return "Capturing";
@@ -99,8 +118,23 @@ IECore::InternedString CapturingRenderer::name() const
 
 void CapturingRenderer::option( const IECore::InternedString &name, const IECore::Object *value )
 {
-	/// \todo Implement
+	/// \todo Implement capture of other options
 	checkPaused();
+	if( name == "cr:hashOnly" )
+	{
+		if( value == nullptr )
+		{
+			m_hashOnly = false;
+		}
+		else if( auto *d = runTimeCast<const BoolData>( value ) )
+		{
+			m_hashOnly = d->readable();
+		}
+		else
+		{
+			IECore::msg( IECore::Msg::Warning, "CapturingRenderer::option", fmt::format( "Expected BoolData for \"{}\"", name.string() ) );
+		}
+	}
 }
 
 void CapturingRenderer::output( const IECore::InternedString &name, const IECoreScene::Output *output )
@@ -112,35 +146,47 @@ void CapturingRenderer::output( const IECore::InternedString &name, const IECore
 Renderer::AttributesInterfacePtr CapturingRenderer::attributes( const IECore::CompoundObject *attributes )
 {
 	checkPaused();
-	return new CapturedAttributes( ConstCompoundObjectPtr( attributes ) );
+	m_statistics.attributes++;
+	return new CapturedAttributes( ConstCompoundObjectPtr( attributes ), m_hashOnly );
 }
 
 Renderer::ObjectInterfacePtr CapturingRenderer::camera( const std::string &name, const IECoreScene::Camera *camera, const AttributesInterface *attributes )
 {
-	return this->object( name, camera, attributes );
+	m_statistics.cameras++;
+	return captureObject( name, { camera }, {}, attributes );
 }
 
 Renderer::ObjectInterfacePtr CapturingRenderer::camera( const std::string &name, const std::vector<const IECoreScene::Camera *> &samples, const std::vector<float> &times, const AttributesInterface *attributes )
 {
-	return this->object( name, vector<const Object *>( samples.begin(), samples.end() ), times, attributes );
+	m_statistics.cameras++;
+	return captureObject( name, vector<const Object *>( samples.begin(), samples.end() ), times, attributes );
 }
 
 Renderer::ObjectInterfacePtr CapturingRenderer::light( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes )
 {
-	return this->object( name, object, attributes );
+	m_statistics.lights++;
+	return captureObject( name, { object }, {}, attributes );
 }
 
 Renderer::ObjectInterfacePtr CapturingRenderer::lightFilter( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes )
 {
-	return this->object( name, object, attributes );
+	m_statistics.lightFilters++;
+	return captureObject( name, { object }, {}, attributes );
 }
 
 Renderer::ObjectInterfacePtr CapturingRenderer::object( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes )
 {
-	return this->object( name, { object }, {}, attributes );
+	m_statistics.objects++;
+	return captureObject( name, { object }, {}, attributes );
 }
 
 Renderer::ObjectInterfacePtr CapturingRenderer::object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes )
+{
+	m_statistics.objects++;
+	return captureObject( name, samples, times, attributes );
+}
+
+Renderer::ObjectInterfacePtr CapturingRenderer::captureObject( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes )
 {
 	IECore::MessageHandler::Scope s( m_messageHandler.get() );
 
@@ -162,7 +208,7 @@ Renderer::ObjectInterfacePtr CapturingRenderer::object( const std::string &name,
 		return nullptr;
 	}
 
-	CapturedObjectPtr result = new CapturedObject( this, name, samples, times );
+	CapturedObjectPtr result = new CapturedObject( this, name, samples, times, m_hashOnly );
 	result->attributes( attributes );
 	a->second = result.get();
 	if( m_renderType != Interactive )
@@ -177,6 +223,14 @@ Renderer::ObjectInterfacePtr CapturingRenderer::object( const std::string &name,
 	return result;
 }
 
+void CapturingRenderer::instances( const std::vector<std::string> &names, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const std::vector<Imath::M44f> &transforms, const std::vector<float> &transformTimes, const AttributesInterface *attributes )
+{
+	m_numInstanceBatches++;
+	// Capture each instance as an individual object, so that instanced renders
+	// can be compared directly with non-instanced ones.
+	Renderer::instances( names, samples, times, transforms, transformTimes, attributes );
+}
+
 void CapturingRenderer::render()
 {
 	IECore::MessageHandler::Scope s( m_messageHandler.get() );
@@ -211,9 +265,25 @@ void CapturingRenderer::checkPaused() const
 // CapturedAttributes
 //////////////////////////////////////////////////////////////////////////
 
-CapturingRenderer::CapturedAttributes::CapturedAttributes( const IECore::ConstCompoundObjectPtr &attributes )
-	:	m_attributes( attributes->copy() )
+CapturingRenderer::CapturedAttributes::CapturedAttributes( const IECore::ConstCompoundObjectPtr &attributes, bool hashOnly )
 {
+	if( hashOnly )
+	{
+		m_hash = attributes->hash();
+	}
+	else
+	{
+		// Shallow copy, so that members shared between attributes (such as
+		// shaders interned by AttributesCache) remain shared when captured.
+		CompoundObjectPtr attributesCopy = new CompoundObject;
+		attributesCopy->members() = attributes->members();
+		m_attributes = attributesCopy;
+	}
+
+	auto *uneditableData = attributes->member<IntData>( "cr:uneditable" );
+	m_uneditableAttributeValue = uneditableData ? uneditableData->readable() : 0;
+	auto *unrenderableData = attributes->member<BoolData>( "cr:unrenderable" );
+	m_unrenderableAttributeValue = unrenderableData && unrenderableData->readable();
 }
 
 const IECore::CompoundObject *CapturingRenderer::CapturedAttributes::attributes() const
@@ -221,25 +291,62 @@ const IECore::CompoundObject *CapturingRenderer::CapturedAttributes::attributes(
 	return m_attributes.get();
 }
 
+IECore::MurmurHash CapturingRenderer::CapturedAttributes::hash() const
+{
+	return m_attributes ? m_attributes->hash() : m_hash;
+}
+
 int CapturingRenderer::CapturedAttributes::uneditableAttributeValue() const
 {
-	auto *data = m_attributes->member<IntData>( "cr:uneditable" );
-	return data ? data->readable() : 0;
+	return m_uneditableAttributeValue;
 }
 
 bool CapturingRenderer::CapturedAttributes::unrenderableAttributeValue() const
 {
-	auto *data = m_attributes->member<BoolData>( "cr:unrenderable" );
-	return data && data->readable();
+	return m_unrenderableAttributeValue;
 }
 
 //////////////////////////////////////////////////////////////////////////
 // CapturedObject
 //////////////////////////////////////////////////////////////////////////
 
-CapturingRenderer::CapturedObject::CapturedObject( CapturingRenderer *renderer, const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times )
-	:	m_renderer( renderer ), m_name( name ), m_capturedSamples( samples.begin(), samples.end() ), m_capturedSampleTimes( times ), m_numAttributeEdits( 0 ), m_id( 0 )
+namespace
+{
+
+// Samples may be null, as they are for lights and light filters
+// without an object.
+template<typename Samples>
+IECore::MurmurHash samplesHash( const Samples &samples, const std::vector<float> &times )
+{
+	IECore::MurmurHash result;
+	for( const auto &s : samples )
+	{
+		if( s )
+		{
+			s->hash( result );
+		}
+		else
+		{
+			result.append( "__nullSample__" );
+		}
+	}
+	result.append( times.data(), times.size() );
+	return result;
+}
+
+} // namespace
+
+CapturingRenderer::CapturedObject::CapturedObject( CapturingRenderer *renderer, const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, bool hashOnly )
+	:	m_renderer( renderer ), m_name( name ), m_capturedSampleTimes( times ), m_numAttributeEdits( 0 ), m_id( 0 )
 {
+	if( hashOnly )
+	{
+		m_capturedSamplesHash = samplesHash( samples, m_capturedSampleTimes );
+	}
+	else
+	{
+		m_capturedSamples.assign( samples.begin(), samples.end() );
+	}
 }
 
 CapturingRenderer::CapturedObject::~CapturedObject()
@@ -267,6 +374,16 @@ const std::vector<float> &CapturingRenderer::CapturedObject::capturedSampleTimes
 	return m_capturedSampleTimes;
 }
 
+IECore::MurmurHash CapturingRenderer::CapturedObject::capturedSamplesHash() const
+{
+	if( m_capturedSamples.empty() )
+	{
+		return m_capturedSamplesHash;
+	}
+
+	return samplesHash( m_capturedSamples, m_capturedSampleTimes );
+}
+
 const std::vector<Imath::M44f> &CapturingRenderer::CapturedObject::capturedTransforms() const
 {
 	return m_capturedTransforms;
@@ -327,6 +444,7 @@ uint32_t CapturingRenderer::CapturedObject::id() const
 void CapturingRenderer::CapturedObject::transform( const Imath::M44f &transform )
 {
 	m_renderer->checkPaused();
+	m_renderer->m_statistics.transformEdits++;
 	m_capturedTransforms.clear();
 	m_capturedTransforms.push_back( transform );
 	m_capturedTransformTimes.clear();
@@ -335,6 +453,7 @@ void CapturingRenderer::CapturedObject::transform( const Imath::M44f &transform
 void CapturingRenderer::CapturedObject::transform( const std::vector<Imath::M44f> &samples, const std::vector<float> &times )
 {
 	m_renderer->checkPaused();
+	m_renderer->m_statistics.transformEdits++;
 	m_capturedTransforms = samples;
 	m_capturedTransformTimes = times;
 }
@@ -354,6 +473,11 @@ bool CapturingRenderer::CapturedObject::attributes( const AttributesInterface *a
 		return false;
 	}
 
+	if( m_capturedAttributes )
+	{
+		m_renderer->m_statistics.attributeEdits++;
+	}
+
 	m_capturedAttributes = capturedAttributes;
 	m_numAttributeEdits++;
 	return true;
@@ -362,6 +486,7 @@ bool CapturingRenderer::CapturedObject::attributes( const AttributesInterface *a
 void CapturingRenderer::CapturedObject::link( const IECore::InternedString &type, const ConstObjectSetPtr &objects )
 {
 	m_renderer->checkPaused();
+	m_renderer->m_statistics.linkEdits++;
 	auto &p = m_capturedLinks[type];
 	p.first = objects;
 	p.second++;
@@ -249,6 +249,15 @@ Renderer::ObjectInterfacePtr CompoundRenderer::object( const std::string &name,
 	return result;
 }
 
+void CompoundRenderer::instances( const std::vector<std::string> &names, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const std::vector<Imath::M44f> &transforms, const std::vector<float> &transformTimes, const AttributesInterface *attributes )
+{
+	auto compoundAttributes = static_cast<const CompoundAttributesInterface *>( attributes );
+	for( size_t i = 0; i < m_renderers.size(); ++i )
+	{
+		m_renderers[i]->instances( names, samples, times, transforms, transformTimes, compoundAttributes->attributes[i].get() );
+	}
+}
+
 void CompoundRenderer::render()
 {
 	for( auto &r : m_renderers )
@@ -38,6 +38,8 @@
 
 #include "IECore/Exception.h"
 
+#include <algorithm>
+
 using namespace std;
 using namespace IECoreScenePreview;
 
@@ -84,6 +86,39 @@ Renderer::ObjectInterfacePtr Renderer::camera( const std::string &name,  const s
 	return camera( name, samples[0], attributes );
 }
 
+void Renderer::instances( const std::vector<std::string> &names, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const std::vector<Imath::M44f> &transforms, const std::vector<float> &transformTimes, const AttributesInterface *attributes )
+{
+	const size_t numTransformSamples = std::max<size_t>( 1, transformTimes.size() );
+	if( transforms.size() != names.size() * numTransformSamples )
+	{
+		throw IECore::Exception( "Renderer::instances : Wrong number of transforms" );
+	}
+
+	vector<Imath::M44f> instanceTransforms;
+	for( size_t i = 0; i < names.size(); ++i )
+	{
+		ObjectInterfacePtr instance = times.empty() ?
+			object( names[i], samples[0], attributes ) :
+			object( names[i], samples, times, attributes )
+		;
+		if( !instance )
+		{
+			continue;
+		}
+
+		if( transformTimes.empty() )
+		{
+			instance->transform( transforms[i] );
+		}
+		else
+		{
+			auto first = transforms.begin() + i * numTransformSamples;
+			instanceTransforms.assign( first, first + numTransformSamples );
+			instance->transform( instanceTransforms, transformTimes );
+		}
+	}
+}
+
 IECore::DataPtr Renderer::command( const IECore::InternedString name, const IECore::CompoundDataMap &parameters )
 {
 	throw IECore::NotImplementedException( "Renderer::command" );
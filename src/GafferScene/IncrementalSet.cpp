@@ -0,0 +1,120 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/IncrementalSet.h"
+
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+#include "Gaffer/ValuePlug.h"
+
+using namespace std;
+using namespace IECore;
+using namespace GafferScene;
+using namespace GafferScene::Private;
+
+namespace
+{
+
+struct Entry
+{
+	ConstPathMatcherDataPtr input;
+	ConstPathMatcherDataPtr output;
+};
+
+using EntryCache = IECorePreview::LRUCache<MurmurHash, Entry>;
+
+EntryCache &entryCache()
+{
+	static EntryCache g_cache(
+		[] ( const MurmurHash &key, size_t &cost, const IECore::Canceller *canceller ) -> Entry {
+			// We only ever use `set()` and `getIfCached()`.
+			throw IECore::Exception( "Entry not available" );
+		},
+		// Entries typically share most of their data with the values in
+		// the compute cache, so we limit the number of entries rather than
+		// their memory usage.
+		10000
+	);
+	// Entries keep their sets alive, so we release them along with the
+	// compute cache.
+	static Gaffer::Signals::Connection g_cacheClearedConnection = Gaffer::ValuePlug::cacheClearedSignal().connect(
+		[] { g_cache.clear(); }
+	);
+	return g_cache;
+}
+
+} // namespace
+
+IECore::ConstPathMatcherDataPtr IncrementalSet::filter( const IECore::MurmurHash &key, const IECore::ConstPathMatcherDataPtr &input, const KeepFunction &keep, const ComputeFunction &compute )
+{
+	EntryCache &cache = entryCache();
+
+	if( std::optional<Entry> previous = cache.getIfCached( key ) )
+	{
+		if( previous->input == input )
+		{
+			return previous->output;
+		}
+
+		PathMatcher added = input->readable();
+		added.removePaths( previous->input->readable() );
+
+		// Patching is only worthwhile if most of the input is unchanged,
+		// otherwise a full compute is faster because it can prune its
+		// traversal of the input.
+		if( added.size() <= input->readable().size() / 2 )
+		{
+			PathMatcher removed = previous->input->readable();
+			removed.removePaths( input->readable() );
+
+			PathMatcherDataPtr output = previous->output->copy();
+			output->writable().removePaths( removed );
+			for( PathMatcher::Iterator it = added.begin(), eIt = added.end(); it != eIt; ++it )
+			{
+				if( keep( *it ) )
+				{
+					output->writable().addPath( *it );
+				}
+			}
+
+			cache.set( key, { input, output }, 1 );
+			return output;
+		}
+	}
+
+	ConstPathMatcherDataPtr output = compute( input.get() );
+	cache.set( key, { input, output }, 1 );
+	return output;
+}
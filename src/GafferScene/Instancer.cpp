@@ -2617,6 +2617,7 @@ struct Prototype : public IECore::RefCounted
 			// Pass through our render options to the sub-capsules
 			newCapsule->setRenderOptions( renderOptions );
 			m_object.push_back( std::move( newCapsule ) );
+			m_objectPointers.push_back( m_object.back().get() );
 		}
 	}
 
@@ -2633,6 +2634,14 @@ struct Prototype : public IECore::RefCounted
 
 typedef boost::intrusive_ptr< const Prototype > ConstPrototypePtr;
 
+// Instances which share a prototype, accumulated for output via `Renderer::instances()`.
+struct InstanceBatch
+{
+	std::vector<std::string> names;
+	// `sampleTimes.size()` consecutive samples per instance.
+	std::vector<M44f> transforms;
+};
+
 struct PrototypeCacheGetterKey
 {
 
@@ -2755,6 +2764,11 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 	// separate processors ). To partially solve this, we set the grain size so that we shouldn't use more
 	// than 32 threads, which appears to help some in testing.
 	size_t grainSize = std::max( (size_t)1, pointIndicesForPrototype.size() / 32 );
+
+	// Transform times for `Renderer::instances()`, which uses an empty vector to
+	// signify a static transform.
+	const vector<float> transformTimes = sampleTimes.size() > 1 ? sampleTimes : vector<float>();
+
 	task_group_context taskGroupContext( task_group_context::isolated );
 
 	const ThreadState &threadState = ThreadState::current();
@@ -2766,7 +2780,7 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 			vector<M44f> pointTransforms( sampleTimes.size() );
 			std::string name;
 			IECoreScenePreview::Renderer::AttributesInterfacePtr attribsStorage;
-
+			std::unordered_map<const Prototype *, InstanceBatch> batches;
 
 			for( size_t idx = r.begin(); idx != r.end(); ++idx )
 			{
@@ -2805,26 +2819,6 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 					continue;
 				}
 
-				IECoreScenePreview::Renderer::AttributesInterface *attribs;
-				if( hasAttributes )
-				{
-					CompoundObjectPtr currentAttributes = new CompoundObject();
-
-					// Since we're not going to modify any existing members (only add new ones),
-					// and our result is only read in this function, and never written, we can
-					// directly reference the input members in our result without copying. Be
-					// careful not to modify them though!
-					currentAttributes->members() = proto->m_attributes->members();
-
-					engines[0]->instanceAttributes( pointIndex, *currentAttributes );
-					attribsStorage = renderer->attributes( currentAttributes.get() );
-					attribs = attribsStorage.get();
-				}
-				else
-				{
-					attribs = proto->m_rendererAttributes.get();
-				}
-
 				int instanceId = engines[0]->instanceId( pointIndex );
 
 				// We are running inside a procedural, so we don't need globally unique name. We are making a whole
@@ -2832,6 +2826,33 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 				name.resize( std::numeric_limits< int >::digits10 + 1 );
 				name.resize( std::to_chars( &name[0], &(*name.end()), instanceId ).ptr - &name[0] );
 
+				if( !hasAttributes )
+				{
+					// All instances of this prototype share the same attributes, so we batch
+					// them up and output them together via `Renderer::instances()` below. This
+					// allows renderers with native instancing support to share a single prototype.
+					InstanceBatch &batch = batches[proto];
+					batch.names.push_back( name );
+					for( unsigned int i = 0; i < engines.size(); i++ )
+					{
+						int curPointIndex = i == 0 ? pointIndex : engines[i]->pointIndex( instanceId );
+						batch.transforms.push_back( proto->m_transforms[i] * engines[i]->instanceTransform( curPointIndex ) );
+					}
+					continue;
+				}
+
+				CompoundObjectPtr currentAttributes = new CompoundObject();
+
+				// Since we're not going to modify any existing members (only add new ones),
+				// and our result is only read in this function, and never written, we can
+				// directly reference the input members in our result without copying. Be
+				// careful not to modify them though!
+				currentAttributes->members() = proto->m_attributes->members();
+
+				engines[0]->instanceAttributes( pointIndex, *currentAttributes );
+				attribsStorage = renderer->attributes( currentAttributes.get() );
+				IECoreScenePreview::Renderer::AttributesInterface *attribs = attribsStorage.get();
+
 				IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
 				if( proto->m_objectSampleTimes.size() )
 				{
@@ -2862,6 +2883,14 @@ void Instancer::InstancerCapsule::render( IECoreScenePreview::Renderer *renderer
 				}
 
 			}
+
+			for( const auto &[proto, batch] : batches )
+			{
+				renderer->instances(
+					batch.names, proto->m_objectPointers, proto->m_objectSampleTimes,
+					batch.transforms, transformTimes, proto->m_rendererAttributes.get()
+				);
+			}
 		},
 		taskGroupContext
 	);
@@ -36,6 +36,8 @@
 
 #include "GafferScene/Isolate.h"
 
+#include "GafferScene/Private/IncrementalSet.h"
+
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
 
@@ -372,57 +374,107 @@ IECore::ConstPathMatcherDataPtr Isolate::computeSet( const IECore::InternedStrin
 		return inputSetData;
 	}
 
-	const PathMatcher &inputSet = inputSetData->readable();
-	if( inputSet.isEmpty() )
+	if( inputSetData->readable().isEmpty() )
 	{
 		return inputSetData;
 	}
 
-	PathMatcherDataPtr outputSetData = inputSetData->copy();
-	PathMatcher &outputSet = outputSetData->writable();
-
-	FilterPlug::SceneScope sceneScope( context, inPlug() );
-	sceneScope.remove( ScenePlug::setNameContextName );
-
 	const std::string fromString = fromPlug()->getValue();
 	ScenePlug::ScenePath fromPath; ScenePlug::stringToPath( fromString, fromPath );
 
+	const bool keepLights = keepLightsPlug()->getValue();
+	const bool keepCameras = keepCamerasPlug()->getValue();
 	const SetsToKeep setsToKeep( this );
 
-	for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; )
+	// Everything except the input set that our result depends on, allowing
+	// us to patch the result from a previous frame when only the input set
+	// has changed. See `hashSet()` for the meaning of the filter hash, and
+	// `Prune::computeSet()` for why we key on our type rather than address.
+	IECore::MurmurHash key;
+	key.append( (uint64_t)staticTypeId() );
+	key.append( setName );
+	key.append( fromString );
+	if( keepLights )
 	{
-		sceneScope.set( ScenePlug::scenePathContextName, &(*pIt) );
-		const int m = filterPlug()->getValue() | setsToKeep.match( *pIt );
-		if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
-		{
-			// We want to keep everything below this point, so
-			// can just prune our iteration.
-			pIt.prune();
-			++pIt;
-		}
-		else if( m & IECore::PathMatcher::DescendantMatch )
-		{
-			// We might be removing things below here,
-			// so just continue our iteration normally
-			// so we can find out.
-			++pIt;
-		}
-		else
-		{
-			assert( m == IECore::PathMatcher::NoMatch );
-			if( boost::starts_with( *pIt, fromPath ) )
+		key.append( inPlug()->setHash( g_lightsSetName ) );
+		key.append( inPlug()->setHash( g_lightFiltersSetName ) );
+	}
+	if( keepCameras )
+	{
+		key.append( inPlug()->setHash( g_camerasSetName ) );
+	}
+
+	FilterPlug::SceneScope sceneScope( context, inPlug() );
+	sceneScope.remove( ScenePlug::scenePathContextName );
+	sceneScope.remove( ScenePlug::setNameContextName );
+	filterPlug()->hash( key );
+
+	return Private::IncrementalSet::filter(
+		key, inputSetData,
+		// Keep. This visits the ancestors of `path` in the same way that
+		// the traversal below does.
+		[&] ( const ScenePlug::ScenePath &path ) {
+			ScenePlug::ScenePath ancestor;
+			ancestor.reserve( path.size() );
+			for( size_t i = 0; i <= path.size(); ++i )
 			{
-				// Not going to keep anything below
-				// here, so we can prune traversal
-				// entirely.
-				outputSet.prune( *pIt );
-				pIt.prune();
+				ancestor.assign( path.begin(), path.begin() + i );
+				sceneScope.set( ScenePlug::scenePathContextName, &ancestor );
+				const int m = filterPlug()->getValue() | setsToKeep.match( ancestor );
+				if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
+				{
+					return true;
+				}
+				else if( !( m & IECore::PathMatcher::DescendantMatch ) && boost::starts_with( ancestor, fromPath ) )
+				{
+					return false;
+				}
 			}
-			++pIt;
-		}
-	}
+			return true;
+		},
+		// Compute
+		[&] ( const PathMatcherData *inputSetData ) -> ConstPathMatcherDataPtr {
 
-	return outputSetData;
+			const PathMatcher &inputSet = inputSetData->readable();
+			PathMatcherDataPtr outputSetData = inputSetData->copy();
+			PathMatcher &outputSet = outputSetData->writable();
+
+			for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; )
+			{
+				sceneScope.set( ScenePlug::scenePathContextName, &(*pIt) );
+				const int m = filterPlug()->getValue() | setsToKeep.match( *pIt );
+				if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
+				{
+					// We want to keep everything below this point, so
+					// can just prune our iteration.
+					pIt.prune();
+					++pIt;
+				}
+				else if( m & IECore::PathMatcher::DescendantMatch )
+				{
+					// We might be removing things below here,
+					// so just continue our iteration normally
+					// so we can find out.
+					++pIt;
+				}
+				else
+				{
+					assert( m == IECore::PathMatcher::NoMatch );
+					if( boost::starts_with( *pIt, fromPath ) )
+					{
+						// Not going to keep anything below
+						// here, so we can prune traversal
+						// entirely.
+						outputSet.prune( *pIt );
+						pIt.prune();
+					}
+					++pIt;
+				}
+			}
+
+			return outputSetData;
+		}
+	);
 }
 
 bool Isolate::mayPruneChildren( const ScenePath &path, const Gaffer::Context *context, const SetsToKeep &setsToKeep ) const
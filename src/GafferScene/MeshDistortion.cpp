@@ -36,6 +36,8 @@
 
 #include "GafferScene/MeshDistortion.h"
 
+#include "GafferScene/Private/ParallelMeshAlgo.h"
+
 #include "IECoreScene/MeshAlgo.h"
 #include "IECoreScene/MeshPrimitive.h"
 
@@ -126,6 +128,11 @@ bool MeshDistortion::affectsProcessedObject( const Gaffer::Plug *input ) const
 	;
 }
 
+Gaffer::ValuePlug::CachePolicy MeshDistortion::processedObjectComputeCachePolicy() const
+{
+	return ValuePlug::CachePolicy::TaskCollaboration;
+}
+
 void MeshDistortion::hashProcessedObject( const ScenePath &path, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ObjectProcessor::hashProcessedObject( path, context, h );
@@ -160,11 +167,18 @@ IECore::ConstObjectPtr MeshDistortion::computeProcessedObject( const ScenePath &
 		return inputObject;
 	}
 
-	auto distortions = MeshAlgo::calculateDistortion(
-		mesh,
-		uvSet,
-		referencePosition,
-		position,
+	const std::vector<PrimitiveVariable> distortions = Private::ParallelMeshAlgo::evaluate(
+		mesh, { position, referencePosition, uvSet },
+		[&] ( const MeshPrimitive *mesh, const Canceller *canceller ) {
+			auto distortions = MeshAlgo::calculateDistortion(
+				mesh,
+				uvSet,
+				referencePosition,
+				position,
+				canceller
+			);
+			return std::vector<PrimitiveVariable>{ distortions.first, distortions.second };
+		},
 		context->canceller()
 	);
 
@@ -172,12 +186,12 @@ IECore::ConstObjectPtr MeshDistortion::computeProcessedObject( const ScenePath &
 
 	if( !distortion.empty() )
 	{
-		result->variables[distortion] = distortions.first;
+		result->variables[distortion] = distortions[0];
 	}
 
 	if( !uvDistortion.empty() )
 	{
-		result->variables[uvDistortion] = distortions.second;
+		result->variables[uvDistortion] = distortions[1];
 	}
 
 	return result;
@@ -36,6 +36,8 @@
 
 #include "GafferScene/MeshNormals.h"
 
+#include "GafferScene/Private/ParallelMeshAlgo.h"
+
 #include "IECoreScene/MeshAlgo.h"
 #include "IECoreScene/MeshPrimitive.h"
 
@@ -154,25 +156,30 @@ IECore::ConstObjectPtr MeshNormals::computeProcessedObject( const ScenePath &pat
 	float thresholdAngle = thresholdAnglePlug()->getValue();
 	std::string position = positionPlug()->getValue();
 
-	MeshPrimitivePtr meshWithNormals = runTimeCast<MeshPrimitive>( mesh->copy() );
+	const std::vector<PrimitiveVariable> normals = Private::ParallelMeshAlgo::evaluate(
+		mesh, { position },
+		[&] ( const MeshPrimitive *mesh, const Canceller *canceller ) -> std::vector<PrimitiveVariable> {
+			if( interpolation == PrimitiveVariable::Uniform )
+			{
+				return { MeshAlgo::calculateUniformNormals( mesh, position ) };
+			}
+			else if( interpolation == PrimitiveVariable::Vertex || interpolation == PrimitiveVariable::Varying )
+			{
+				return { MeshAlgo::calculateVertexNormals( mesh, weighting, position ) };
+			}
+			else if( interpolation == PrimitiveVariable::FaceVarying )
+			{
+				return { MeshAlgo::calculateFaceVaryingNormals( mesh, weighting, thresholdAngle, position ) };
+			}
+			return {};
+		},
+		context->canceller()
+	);
 
-	if( interpolation == PrimitiveVariable::Uniform )
-	{
-		meshWithNormals->variables[ normal ] = MeshAlgo::calculateUniformNormals(
-			meshWithNormals.get(), position
-		);
-	}
-	else if( interpolation == PrimitiveVariable::Vertex || interpolation == PrimitiveVariable::Varying )
-	{
-		meshWithNormals->variables[ normal ] = MeshAlgo::calculateVertexNormals(
-			meshWithNormals.get(), weighting, position
-		);
-	}
-	else if( interpolation == PrimitiveVariable::FaceVarying )
+	MeshPrimitivePtr meshWithNormals = runTimeCast<MeshPrimitive>( mesh->copy() );
+	if( normals.size() )
 	{
-		meshWithNormals->variables[ normal ] = MeshAlgo::calculateFaceVaryingNormals(
-			meshWithNormals.get(), weighting, thresholdAngle, position
-		);
+		meshWithNormals->variables[ normal ] = normals[0];
 	}
 
 	return meshWithNormals;
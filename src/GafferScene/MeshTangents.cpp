@@ -36,6 +36,8 @@
 
 #include "GafferScene/MeshTangents.h"
 
+#include "GafferScene/Private/ParallelMeshAlgo.h"
+
 #include "IECoreScene/MeshAlgo.h"
 #include "IECoreScene/MeshPrimitive.h"
 
@@ -185,6 +187,11 @@ bool MeshTangents::affectsProcessedObject( const Gaffer::Plug *input ) const
 	;
 }
 
+Gaffer::ValuePlug::CachePolicy MeshTangents::processedObjectComputeCachePolicy() const
+{
+	return ValuePlug::CachePolicy::TaskCollaboration;
+}
+
 void MeshTangents::hashProcessedObject( const ScenePath &path, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ObjectProcessor::hashProcessedObject( path, context, h );
@@ -214,7 +221,7 @@ IECore::ConstObjectPtr MeshTangents::computeProcessedObject( const ScenePath &pa
 	Mode mode = (Mode) modePlug()->getValue();
 
 	MeshPrimitivePtr meshWithTangents = runTimeCast<MeshPrimitive>( mesh->copy() );
-	std::pair<PrimitiveVariable, PrimitiveVariable> tangentPrimvars;
+	std::vector<PrimitiveVariable> tangentPrimvars;
 
 	if ( mode == Mode::UV )
 	{
@@ -222,10 +229,17 @@ IECore::ConstObjectPtr MeshTangents::computeProcessedObject( const ScenePath &pa
 		std::string uTangent = uTangentPlug()->getValue();
 		std::string vTangent = vTangentPlug()->getValue();
 
-		tangentPrimvars = MeshAlgo::calculateTangentsFromUV( mesh, uvSet, position, ortho, leftHanded, context->canceller() );
-
-		meshWithTangents->variables[uTangent] = tangentPrimvars.first;
-		meshWithTangents->variables[vTangent] = tangentPrimvars.second;
+		tangentPrimvars = Private::ParallelMeshAlgo::evaluate(
+			mesh, { position, uvSet },
+			[&] ( const MeshPrimitive *mesh, const Canceller *canceller ) {
+				auto tangents = MeshAlgo::calculateTangentsFromUV( mesh, uvSet, position, ortho, leftHanded, canceller );
+				return std::vector<PrimitiveVariable>{ tangents.first, tangents.second };
+			},
+			context->canceller()
+		);
+
+		meshWithTangents->variables[uTangent] = tangentPrimvars[0];
+		meshWithTangents->variables[vTangent] = tangentPrimvars[1];
 	}
 	else
 	{
@@ -233,21 +247,29 @@ IECore::ConstObjectPtr MeshTangents::computeProcessedObject( const ScenePath &pa
 		std::string tangent = tangentPlug()->getValue();
 		std::string biTangent = biTangentPlug()->getValue();
 
-		if ( mode == Mode::FirstEdge )
-		{
-			tangentPrimvars = MeshAlgo::calculateTangentsFromFirstEdge( mesh, position, normal, ortho, leftHanded, context->canceller() );
-		}
-		else if ( mode == Mode::TwoEdges )
-		{
-			tangentPrimvars = MeshAlgo::calculateTangentsFromTwoEdges( mesh, position, normal, ortho, leftHanded, context->canceller() );
-		}
-		else
-		{
-			tangentPrimvars = MeshAlgo::calculateTangentsFromPrimitiveCentroid( mesh, position, normal, ortho, leftHanded, context->canceller() );
-		}
-
-		meshWithTangents->variables[tangent] = tangentPrimvars.first;
-		meshWithTangents->variables[biTangent] = tangentPrimvars.second;
+		tangentPrimvars = Private::ParallelMeshAlgo::evaluate(
+			mesh, { position, normal },
+			[&] ( const MeshPrimitive *mesh, const Canceller *canceller ) {
+				std::pair<PrimitiveVariable, PrimitiveVariable> tangents;
+				if ( mode == Mode::FirstEdge )
+				{
+					tangents = MeshAlgo::calculateTangentsFromFirstEdge( mesh, position, normal, ortho, leftHanded, canceller );
+				}
+				else if ( mode == Mode::TwoEdges )
+				{
+					tangents = MeshAlgo::calculateTangentsFromTwoEdges( mesh, position, normal, ortho, leftHanded, canceller );
+				}
+				else
+				{
+					tangents = MeshAlgo::calculateTangentsFromPrimitiveCentroid( mesh, position, normal, ortho, leftHanded, canceller );
+				}
+				return std::vector<PrimitiveVariable>{ tangents.first, tangents.second };
+			},
+			context->canceller()
+		);
+
+		meshWithTangents->variables[tangent] = tangentPrimvars[0];
+		meshWithTangents->variables[biTangent] = tangentPrimvars[1];
 	}
 
 	return meshWithTangents;
@@ -0,0 +1,596 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/ParallelMeshAlgo.h"
+
+#include "IECore/DataAlgo.h"
+#include "IECore/GeometricTypedData.h"
+#include "IECore/TypeTraits.h"
+#include "IECore/VectorTypedData.h"
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace std;
+using namespace IECore;
+using namespace IECoreScene;
+using namespace GafferScene::Private;
+
+namespace
+{
+
+// Meshes with fewer faces than this are processed directly, because
+// the overhead of building submeshes would outweigh any gain.
+const size_t g_minParallelFaces = 100000;
+// Number of faces owned by each chunk.
+const size_t g_chunkSize = 25000;
+// Point generation is typically much more expensive per face, so uses
+// smaller chunks.
+const size_t g_minPointsChunkSize = 100;
+const size_t g_maxPointsChunks = 1024;
+
+// Returns empty data of the same type and interpretation as `data`.
+template<typename DataType>
+typename DataType::Ptr emptyCopy( const DataType *data )
+{
+	typename DataType::Ptr result = new DataType;
+	if( auto geometricData = runTimeCast<const GeometricData>( data ) )
+	{
+		static_cast<GeometricData *>( result.get() )->setInterpretation( geometricData->getInterpretation() );
+	}
+	return result;
+}
+
+// Returns a copy of `data` containing only `elements`, or null if
+// `data` isn't vector data.
+DataPtr subset( const Data *data, const vector<int> &elements )
+{
+	return dispatch(
+		data,
+		[&elements] ( const auto *typedData ) -> DataPtr {
+			using DataType = remove_const_t<remove_pointer_t<decltype( typedData )>>;
+			if constexpr( !TypeTraits::IsVectorTypedData<DataType>::value )
+			{
+				return nullptr;
+			}
+			else
+			{
+				typename DataType::Ptr result = emptyCopy( typedData );
+				const auto &in = typedData->readable();
+				auto &out = result->writable();
+				out.reserve( elements.size() );
+				for( int i : elements )
+				{
+					out.push_back( in[i] );
+				}
+				return result;
+			}
+		}
+	);
+}
+
+vector<int> subset( const vector<int> &data, const vector<int> &elements )
+{
+	vector<int> result;
+	result.reserve( elements.size() );
+	for( int i : elements )
+	{
+		result.push_back( data[i] );
+	}
+	return result;
+}
+
+// Returns true if every index refers to data used by only a single vertex.
+// This is required for indexed FaceVarying inputs, as functions may accumulate
+// values per index rather than per vertex.
+bool indicesFollowVertices( const vector<int> &indices, const vector<int> &vertexIds, size_t dataSize )
+{
+	vector<int> indexVertices( dataSize, -1 );
+	for( size_t i = 0; i < indices.size(); ++i )
+	{
+		int &v = indexVertices[indices[i]];
+		if( v == -1 )
+		{
+			v = vertexIds[i];
+		}
+		else if( v != vertexIds[i] )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Returns a mesh containing only `faces`, which must be sorted, along with
+// the primitive variables named in `variables`. The original indices of
+// the vertices used by the submesh are returned in `vertices`, and the
+// offset of each face into the face-varying data of the submesh is
+// returned in `subFaceOffsets`.
+MeshPrimitivePtr createSubmesh(
+	const MeshPrimitive *mesh, const vector<int> &faceOffsets, const vector<int> &faces, const vector<string> &variables,
+	vector<int> &vertices, vector<int> &subFaceOffsets
+)
+{
+	const vector<int> &verticesPerFace = mesh->verticesPerFace()->readable();
+	const vector<int> &vertexIds = mesh->vertexIds()->readable();
+
+	vector<int> faceVertices;
+	for( int f : faces )
+	{
+		for( int i = faceOffsets[f], e = faceOffsets[f] + verticesPerFace[f]; i < e; ++i )
+		{
+			faceVertices.push_back( i );
+		}
+	}
+
+	vertices = subset( vertexIds, faceVertices );
+	std::sort( vertices.begin(), vertices.end() );
+	vertices.erase( std::unique( vertices.begin(), vertices.end() ), vertices.end() );
+
+	IntVectorDataPtr subVerticesPerFaceData = new IntVectorData( subset( verticesPerFace, faces ) );
+	IntVectorDataPtr subVertexIdsData = new IntVectorData;
+	vector<int> &subVertexIds = subVertexIdsData->writable();
+	subVertexIds.reserve( faceVertices.size() );
+	for( int i : faceVertices )
+	{
+		subVertexIds.push_back( std::lower_bound( vertices.begin(), vertices.end(), vertexIds[i] ) - vertices.begin() );
+	}
+
+	subFaceOffsets.reserve( faces.size() );
+	int subOffset = 0;
+	for( int n : subVerticesPerFaceData->readable() )
+	{
+		subFaceOffsets.push_back( subOffset );
+		subOffset += n;
+	}
+
+	MeshPrimitivePtr result = new MeshPrimitive( subVerticesPerFaceData, subVertexIdsData, mesh->interpolation() );
+	for( const auto &name : variables )
+	{
+		const PrimitiveVariable &variable = mesh->variables.find( name )->second;
+		const vector<int> *elements = nullptr;
+		switch( variable.interpolation )
+		{
+			case PrimitiveVariable::Uniform :
+				elements = &faces;
+				break;
+			case PrimitiveVariable::Vertex :
+			case PrimitiveVariable::Varying :
+				elements = &vertices;
+				break;
+			case PrimitiveVariable::FaceVarying :
+				elements = &faceVertices;
+				break;
+			default :
+				break;
+		}
+
+		if( !elements )
+		{
+			result->variables[name] = variable;
+		}
+		else if( variable.indices )
+		{
+			result->variables[name] = PrimitiveVariable(
+				variable.interpolation, variable.data,
+				new IntVectorData( subset( variable.indices->readable(), *elements ) )
+			);
+		}
+		else
+		{
+			result->variables[name] = PrimitiveVariable( variable.interpolation, subset( variable.data.get(), *elements ) );
+		}
+	}
+
+	return result;
+}
+
+struct Chunk
+{
+	// Range of faces owned by the chunk.
+	size_t begin;
+	size_t end;
+	// Sorted lists of the faces and vertices in the submesh, including the
+	// halo of neighbouring faces.
+	vector<int> faces;
+	vector<int> vertices;
+	// Offset of each submesh face into the submesh face-varying data.
+	vector<int> faceOffsets;
+	vector<PrimitiveVariable> result;
+};
+
+size_t variableSize( const Chunk &chunk, PrimitiveVariable::Interpolation interpolation, const vector<int> &verticesPerFace )
+{
+	switch( interpolation )
+	{
+		case PrimitiveVariable::Uniform :
+			return chunk.faces.size();
+		case PrimitiveVariable::Vertex :
+		case PrimitiveVariable::Varying :
+			return chunk.vertices.size();
+		case PrimitiveVariable::FaceVarying :
+			return chunk.faceOffsets.empty() ? 0 : chunk.faceOffsets.back() + verticesPerFace[chunk.faces.back()];
+		default :
+			return 1;
+	}
+}
+
+// Returns true if the chunk results can be combined into a result for the
+// whole mesh.
+bool combinable( const vector<Chunk> &chunks, const vector<int> &verticesPerFace )
+{
+	const vector<PrimitiveVariable> &reference = chunks.front().result;
+	for( const auto &chunk : chunks )
+	{
+		if( chunk.result.size() != reference.size() )
+		{
+			return false;
+		}
+		for( size_t i = 0; i < reference.size(); ++i )
+		{
+			const PrimitiveVariable &v = chunk.result[i];
+			if(
+				v.interpolation != reference[i].interpolation ||
+				v.interpolation == PrimitiveVariable::Constant ||
+				v.interpolation == PrimitiveVariable::Invalid ||
+				v.indices || !v.data ||
+				v.data->typeId() != reference[i].data->typeId() ||
+				v.data->typeId() == BoolVectorDataTypeId ||
+				IECore::size( v.data.get() ) != variableSize( chunk, v.interpolation, verticesPerFace )
+			)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+} // namespace
+
+std::vector<PrimitiveVariable> ParallelMeshAlgo::evaluate( const MeshPrimitive *mesh, const std::vector<std::string> &variables, const MeshFunction &function, const IECore::Canceller *canceller )
+{
+	const size_t numFaces = mesh->numFaces();
+	if( numFaces < g_minParallelFaces )
+	{
+		return function( mesh, canceller );
+	}
+
+	const vector<int> &verticesPerFace = mesh->verticesPerFace()->readable();
+	const vector<int> &vertexIds = mesh->vertexIds()->readable();
+	const size_t numVertices = mesh->variableSize( PrimitiveVariable::Vertex );
+
+	// Validate inputs. For anything unusual we defer to `function`, so that
+	// it can report errors in exactly the way it would otherwise.
+
+	for( const auto &name : variables )
+	{
+		auto it = mesh->variables.find( name );
+		if( it == mesh->variables.end() || !mesh->isPrimitiveVariableValid( it->second ) )
+		{
+			return function( mesh, canceller );
+		}
+		if( it->second.interpolation == PrimitiveVariable::FaceVarying && it->second.indices )
+		{
+			if( !indicesFollowVertices( it->second.indices->readable(), vertexIds, size( it->second.data.get() ) ) )
+			{
+				return function( mesh, canceller );
+			}
+		}
+	}
+
+	// Build adjacency from vertices to faces, and find the first face using each
+	// vertex. That face's chunk is responsible for outputting the vertex.
+
+	vector<int> faceOffsets( numFaces );
+	vector<int> firstFace( numVertices, -1 );
+	vector<int> vertexFaceOffsets( numVertices + 1, 0 );
+	int offset = 0;
+	for( size_t f = 0; f < numFaces; ++f )
+	{
+		faceOffsets[f] = offset;
+		for( int i = offset, e = offset + verticesPerFace[f]; i < e; ++i )
+		{
+			const int v = vertexIds[i];
+			vertexFaceOffsets[v+1]++;
+			if( firstFace[v] == -1 )
+			{
+				firstFace[v] = f;
+			}
+		}
+		offset += verticesPerFace[f];
+	}
+
+	if( std::find( firstFace.begin(), firstFace.end(), -1 ) != firstFace.end() )
+	{
+		// Unused vertices are not owned by any chunk.
+		return function( mesh, canceller );
+	}
+
+	std::partial_sum( vertexFaceOffsets.begin(), vertexFaceOffsets.end(), vertexFaceOffsets.begin() );
+	vector<int> vertexFaces( vertexFaceOffsets.back() );
+	{
+		vector<int> fill( vertexFaceOffsets.begin(), vertexFaceOffsets.end() - 1 );
+		for( size_t f = 0; f < numFaces; ++f )
+		{
+			for( int i = faceOffsets[f], e = faceOffsets[f] + verticesPerFace[f]; i < e; ++i )
+			{
+				vertexFaces[fill[vertexIds[i]]++] = f;
+			}
+		}
+	}
+
+	// Evaluate `function` on a submesh for each chunk. Each submesh contains
+	// the chunk's faces plus all faces sharing a vertex with them, so
+	// every element owned by the chunk sees the same neighbourhood as it
+	// would in the full mesh. Faces and vertices retain their original
+	// order, so accumulations happen in the same order too.
+
+	vector<Chunk> chunks( ( numFaces + g_chunkSize - 1 ) / g_chunkSize );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, chunks.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			for( size_t c = range.begin(); c != range.end(); ++c )
+			{
+				Canceller::check( canceller );
+
+				Chunk &chunk = chunks[c];
+				chunk.begin = c * g_chunkSize;
+				chunk.end = std::min( numFaces, chunk.begin + g_chunkSize );
+
+				for( size_t f = chunk.begin; f < chunk.end; ++f )
+				{
+					for( int i = faceOffsets[f], e = faceOffsets[f] + verticesPerFace[f]; i < e; ++i )
+					{
+						const int v = vertexIds[i];
+						chunk.faces.insert( chunk.faces.end(), vertexFaces.begin() + vertexFaceOffsets[v], vertexFaces.begin() + vertexFaceOffsets[v+1] );
+					}
+				}
+				std::sort( chunk.faces.begin(), chunk.faces.end() );
+				chunk.faces.erase( std::unique( chunk.faces.begin(), chunk.faces.end() ), chunk.faces.end() );
+
+				MeshPrimitivePtr submesh = createSubmesh( mesh, faceOffsets, chunk.faces, variables, chunk.vertices, chunk.faceOffsets );
+				chunk.result = function( submesh.get(), canceller );
+			}
+		},
+		taskGroupContext
+	);
+
+	if( !combinable( chunks, verticesPerFace ) )
+	{
+		return function( mesh, canceller );
+	}
+
+	// Combine the elements owned by each chunk into the final result.
+
+	vector<PrimitiveVariable> result;
+	for( size_t i = 0; i < chunks.front().result.size(); ++i )
+	{
+		const PrimitiveVariable::Interpolation interpolation = chunks.front().result[i].interpolation;
+		dispatch(
+			chunks.front().result[i].data.get(),
+			[&] ( const auto *typedData ) {
+				using DataType = remove_const_t<remove_pointer_t<decltype( typedData )>>;
+				if constexpr( TypeTraits::IsVectorTypedData<DataType>::value )
+				{
+					typename DataType::Ptr data = emptyCopy( typedData );
+					auto &out = data->writable();
+					out.resize( mesh->variableSize( interpolation ) );
+
+					tbb::parallel_for(
+						tbb::blocked_range<size_t>( 0, chunks.size() ),
+						[&] ( const tbb::blocked_range<size_t> &range ) {
+							for( size_t c = range.begin(); c != range.end(); ++c )
+							{
+								const Chunk &chunk = chunks[c];
+								const auto &in = static_cast<const DataType *>( chunk.result[i].data.get() )->readable();
+								const size_t firstOwnedFace = std::lower_bound( chunk.faces.begin(), chunk.faces.end(), (int)chunk.begin ) - chunk.faces.begin();
+								switch( interpolation )
+								{
+									case PrimitiveVariable::Uniform :
+										std::copy( in.begin() + firstOwnedFace, in.begin() + firstOwnedFace + ( chunk.end - chunk.begin ), out.begin() + chunk.begin );
+										break;
+									case PrimitiveVariable::FaceVarying :
+										for( size_t f = chunk.begin, subF = firstOwnedFace; f < chunk.end; ++f, ++subF )
+										{
+											auto first = in.begin() + chunk.faceOffsets[subF];
+											std::copy( first, first + verticesPerFace[f], out.begin() + faceOffsets[f] );
+										}
+										break;
+									default :
+										for( size_t subV = 0; subV < chunk.vertices.size(); ++subV )
+										{
+											const int v = chunk.vertices[subV];
+											if( firstFace[v] >= (int)chunk.begin && firstFace[v] < (int)chunk.end )
+											{
+												out[v] = in[subV];
+											}
+										}
+										break;
+								}
+							}
+						},
+						taskGroupContext
+					);
+
+					result.push_back( PrimitiveVariable( interpolation, data ) );
+				}
+			}
+		);
+	}
+
+	return result;
+}
+
+IECoreScene::PointsPrimitivePtr ParallelMeshAlgo::generatePoints( const IECoreScene::MeshPrimitive *mesh, const PointsFunction &function, const IECore::Canceller *canceller )
+{
+	// The chunking depends only on the mesh, so the results are independent
+	// of the number of threads.
+	const size_t numFaces = mesh->numFaces();
+	const size_t chunkSize = std::max( g_minPointsChunkSize, ( numFaces + g_maxPointsChunks - 1 ) / g_maxPointsChunks );
+	if( numFaces <= chunkSize )
+	{
+		return function( mesh, canceller );
+	}
+
+	vector<string> variables;
+	for( const auto &[name, variable] : mesh->variables )
+	{
+		if( !mesh->isPrimitiveVariableValid( variable ) )
+		{
+			return function( mesh, canceller );
+		}
+		variables.push_back( name );
+	}
+
+	const vector<int> &verticesPerFace = mesh->verticesPerFace()->readable();
+	vector<int> faceOffsets( numFaces, 0 );
+	std::partial_sum( verticesPerFace.begin(), verticesPerFace.end() - 1, faceOffsets.begin() + 1 );
+
+	// Generate points for each chunk of faces in parallel.
+
+	vector<PointsPrimitivePtr> chunks( ( numFaces + chunkSize - 1 ) / chunkSize );
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, chunks.size() ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			for( size_t c = range.begin(); c != range.end(); ++c )
+			{
+				Canceller::check( canceller );
+
+				const size_t begin = c * chunkSize;
+				vector<int> faces( std::min( numFaces, begin + chunkSize ) - begin );
+				std::iota( faces.begin(), faces.end(), begin );
+
+				vector<int> vertices;
+				vector<int> subFaceOffsets;
+				MeshPrimitivePtr submesh = createSubmesh( mesh, faceOffsets, faces, variables, vertices, subFaceOffsets );
+				chunks[c] = function( submesh.get(), canceller );
+			}
+		},
+		taskGroupContext
+	);
+
+	// Check that the chunks can be concatenated, and compute the offset of
+	// each into the final result.
+
+	const PointsPrimitive *reference = chunks.front().get();
+	vector<size_t> pointOffsets( chunks.size() + 1, 0 );
+	for( size_t c = 0; c < chunks.size(); ++c )
+	{
+		const PointsPrimitive *points = chunks[c].get();
+		if( !points || points->variables.size() != reference->variables.size() )
+		{
+			return function( mesh, canceller );
+		}
+		for( const auto &[name, variable] : points->variables )
+		{
+			auto it = reference->variables.find( name );
+			if(
+				it == reference->variables.end() ||
+				variable.interpolation != it->second.interpolation ||
+				variable.indices || !variable.data ||
+				variable.data->typeId() != it->second.data->typeId()
+			)
+			{
+				return function( mesh, canceller );
+			}
+			if( variable.interpolation == PrimitiveVariable::Constant )
+			{
+				if( *variable.data != *it->second.data )
+				{
+					return function( mesh, canceller );
+				}
+			}
+			else if(
+				( variable.interpolation != PrimitiveVariable::Vertex && variable.interpolation != PrimitiveVariable::Varying ) ||
+				variable.data->typeId() == BoolVectorDataTypeId ||
+				IECore::size( variable.data.get() ) != points->getNumPoints()
+			)
+			{
+				return function( mesh, canceller );
+			}
+		}
+		pointOffsets[c+1] = pointOffsets[c] + points->getNumPoints();
+	}
+
+	// Concatenate the chunks into preallocated arrays.
+
+	PointsPrimitivePtr result = new PointsPrimitive( pointOffsets.back() );
+	for( const auto &[name, variable] : reference->variables )
+	{
+		if( variable.interpolation == PrimitiveVariable::Constant )
+		{
+			result->variables[name] = variable;
+			continue;
+		}
+
+		dispatch(
+			variable.data.get(),
+			[&, name = name, interpolation = variable.interpolation] ( const auto *typedData ) {
+				using DataType = remove_const_t<remove_pointer_t<decltype( typedData )>>;
+				if constexpr( TypeTraits::IsVectorTypedData<DataType>::value )
+				{
+					typename DataType::Ptr data = emptyCopy( typedData );
+					auto &out = data->writable();
+					out.resize( pointOffsets.back() );
+
+					tbb::parallel_for(
+						tbb::blocked_range<size_t>( 0, chunks.size() ),
+						[&] ( const tbb::blocked_range<size_t> &range ) {
+							for( size_t c = range.begin(); c != range.end(); ++c )
+							{
+								const auto &in = static_cast<const DataType *>( chunks[c]->variables.find( name )->second.data.get() )->readable();
+								std::copy( in.begin(), in.end(), out.begin() + pointOffsets[c] );
+							}
+						},
+						taskGroupContext
+					);
+
+					result->variables[name] = PrimitiveVariable( interpolation, data );
+				}
+			}
+		);
+	}
+
+	return result;
+}
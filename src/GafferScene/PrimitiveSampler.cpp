@@ -38,11 +38,14 @@
 
 #include "GafferScene/SceneAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECoreScene/MeshAlgo.h"
 #include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/PrimitiveEvaluator.h"
 
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_sort.h"
 
 using namespace std;
 using namespace tbb;
@@ -149,6 +152,77 @@ OutputVariableFunction addPrimitiveVariable( Primitive *outputPrimitive, const s
 
 }
 
+// Evaluator cache
+// ===============
+//
+// Building a PrimitiveEvaluator (and the acceleration structure within it) is
+// expensive, and it is common to sample the same source primitive for many
+// destination locations, or from several samplers. So we cache evaluators
+// by the hash of the source object, and share them between all samplers.
+// The cache is cleared along with the compute cache by `ValuePlug::clearCache()`.
+
+struct EvaluatorCacheGetterKey
+{
+
+	EvaluatorCacheGetterKey( const IECore::MurmurHash &objectHash, const Primitive *primitive )
+		:	objectHash( objectHash ), primitive( primitive )
+	{
+	}
+
+	operator const IECore::MurmurHash & () const
+	{
+		return objectHash;
+	}
+
+	const IECore::MurmurHash objectHash;
+	const Primitive *primitive;
+
+};
+
+using EvaluatorCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstPrimitiveEvaluatorPtr, IECorePreview::LRUCachePolicy::TaskParallel, EvaluatorCacheGetterKey>;
+
+EvaluatorCache &evaluatorCache()
+{
+	static EvaluatorCache g_cache(
+		[] ( const EvaluatorCacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller ) -> ConstPrimitiveEvaluatorPtr {
+			ConstPrimitivePtr primitive = key.primitive;
+			if( auto mesh = runTimeCast<const MeshPrimitive>( primitive.get() ) )
+			{
+				primitive = MeshAlgo::triangulate( mesh, canceller );
+			}
+			// Cost is approximated as twice the memory usage of the primitive,
+			// to account for the acceleration structure.
+			cost = primitive->memoryUsage() * 2;
+			return PrimitiveEvaluator::create( primitive );
+		},
+		// 1Gb
+		1024 * 1024 * 1024
+	);
+	static Signals::Connection g_cacheClearedConnection = ValuePlug::cacheClearedSignal().connect(
+		[] { g_cache.clear(); }
+	);
+	return g_cache;
+}
+
+// Sampling order
+// ==============
+
+// Spreads the lower 10 bits of `x` so that there are two zero bits
+// between each, for the computation of a 30 bit Morton code.
+uint32_t spreadBits( uint32_t x )
+{
+	x &= 0x3ff;
+	x = ( x | ( x << 16 ) ) & 0x030000ff;
+	x = ( x | ( x << 8 ) ) & 0x0300f00f;
+	x = ( x | ( x << 4 ) ) & 0x030c30c3;
+	x = ( x | ( x << 2 ) ) & 0x09249249;
+	return x;
+}
+
+// Sampling order is only worth computing when there are enough
+// queries to benefit from improved coherence.
+const size_t g_minSamplingOrderSize = 1024;
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -306,16 +380,15 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 		return inputObject;
 	}
 
-	ConstPrimitivePtr preprocessedSourcePrimitive = sourcePrimitive;
-	if( auto mesh = runTimeCast<const MeshPrimitive>( preprocessedSourcePrimitive.get() ) )
-	{
-		preprocessedSourcePrimitive = MeshAlgo::triangulate( mesh, context->canceller() );
-	}
-	PrimitiveEvaluatorPtr evaluator = PrimitiveEvaluator::create( preprocessedSourcePrimitive );
+	ConstPrimitiveEvaluatorPtr evaluator = evaluatorCache().get(
+		EvaluatorCacheGetterKey( sourcePlug()->objectHash( sourcePath ), sourcePrimitive ),
+		context->canceller()
+	);
 	if( !evaluator )
 	{
 		return inputObject;
 	}
+	ConstPrimitivePtr preprocessedSourcePrimitive = evaluator->primitive();
 
 	PrimitivePtr outputPrimitive = inputPrimitive->copy();
 	const size_t size = outputPrimitive->variableSize( outputInterpolation );
@@ -349,11 +422,18 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 
 	const M44f samplingTransform = transform * sourceTransform.inverse();
 
+	vector<size_t> order;
+	if( size >= g_minSamplingOrderSize )
+	{
+		computeSamplingOrder( inputPrimitive, outputInterpolation, order );
+	}
+
 	auto rangeSampler = [&]( const blocked_range<size_t> &r ) {
 		PrimitiveEvaluator::ResultPtr evaluatorResult = evaluator->createResult();
-		for( size_t i = r.begin(); i != r.end(); ++i )
+		for( size_t j = r.begin(); j != r.end(); ++j )
 		{
 			Canceller::check( context->canceller() );
+			const size_t i = order.size() ? order[j] : j;
 			if( samplingFunction( *evaluator, i, samplingTransform, *evaluatorResult ) )
 			{
 				for( const auto &o : outputVariables )
@@ -396,3 +476,54 @@ bool PrimitiveSampler::affectsSamplingFunction( const Gaffer::Plug *input ) cons
 void PrimitiveSampler::hashSamplingFunction( IECore::MurmurHash &h ) const
 {
 }
+
+void PrimitiveSampler::computeSamplingOrder( const IECoreScene::Primitive *destinationPrimitive, IECoreScene::PrimitiveVariable::Interpolation interpolation, std::vector<size_t> &order ) const
+{
+}
+
+void PrimitiveSampler::spatialOrder( const std::vector<Imath::V3f> &positions, std::vector<size_t> &order )
+{
+	order.clear();
+
+	Box3f bound;
+	for( const auto &p : positions )
+	{
+		bound.extendBy( p );
+	}
+
+	if( bound.isEmpty() )
+	{
+		return;
+	}
+
+	V3f scale = bound.size();
+	for( int i = 0; i < 3; ++i )
+	{
+		scale[i] = scale[i] > 0.0f ? 1023.0f / scale[i] : 0.0f;
+	}
+
+	// Sort by Morton code, so that positions which are close in space are
+	// also close in the sampling order.
+	vector<std::pair<uint32_t, size_t>> codes( positions.size() );
+	parallel_for(
+		blocked_range<size_t>( 0, positions.size() ),
+		[&] ( const blocked_range<size_t> &r ) {
+			for( size_t i = r.begin(); i != r.end(); ++i )
+			{
+				const V3f p = ( positions[i] - bound.min ) * scale;
+				codes[i] = {
+					spreadBits( (uint32_t)p.x ) | ( spreadBits( (uint32_t)p.y ) << 1 ) | ( spreadBits( (uint32_t)p.z ) << 2 ),
+					i
+				};
+			}
+		}
+	);
+
+	parallel_sort( codes.begin(), codes.end() );
+
+	order.resize( codes.size() );
+	for( size_t i = 0; i < codes.size(); ++i )
+	{
+		order[i] = codes[i].second;
+	}
+}
@@ -37,6 +37,8 @@
 
 #include "GafferScene/PrimitiveVariableProcessor.h"
 
+#include "GafferScene/Private/PrimitiveAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
 #include "IECore/StringAlgo.h"
@@ -131,7 +133,7 @@ IECore::ConstObjectPtr PrimitiveVariableProcessor::computeProcessedObject( const
 	const std::string names = namesPlug()->getValue();
 
 	bool invert = invertNamesPlug()->getValue();
-	IECoreScene::PrimitivePtr result = inputGeometry->copy();
+	IECoreScene::PrimitivePtr result = Private::PrimitiveAlgo::copyWithSharedVariables( inputGeometry.get() );
 	IECoreScene::PrimitiveVariableMap::iterator next;
 	for( IECoreScene::PrimitiveVariableMap::iterator it = result->variables.begin(); it != result->variables.end(); it = next )
 	{
@@ -139,6 +141,10 @@ IECore::ConstObjectPtr PrimitiveVariableProcessor::computeProcessedObject( const
 		next++;
 		if( StringAlgo::matchMultiple( it->first, names ) != invert )
 		{
+			// The data is shared with `inputGeometry`, so we give subclasses
+			// their own copy in case they modify it in place. This is cheap,
+			// because the underlying arrays are only copied on write.
+			it->second = PrimitiveVariable( it->second, /* deepCopy = */ true );
 			processPrimitiveVariable( path, context, inputGeometry, it->second );
 			if( it->second.interpolation == IECoreScene::PrimitiveVariable::Invalid || !it->second.data )
 			{
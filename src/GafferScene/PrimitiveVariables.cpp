@@ -36,6 +36,8 @@
 
 #include "GafferScene/PrimitiveVariables.h"
 
+#include "GafferScene/Private/PrimitiveAlgo.h"
+
 #include "IECoreScene/Primitive.h"
 
 using namespace IECore;
@@ -103,7 +105,7 @@ IECore::ConstObjectPtr PrimitiveVariables::computeProcessedObject( const ScenePa
 		return inputObject;
 	}
 
-	PrimitivePtr result = inputPrimitive->copy();
+	PrimitivePtr result = Private::PrimitiveAlgo::copyWithSharedVariables( inputPrimitive );
 
 	std::string name;
 	for( NameValuePlug::Iterator it( p ); !it.done(); ++it )
@@ -36,6 +36,8 @@
 
 #include "GafferScene/Prune.h"
 
+#include "GafferScene/Private/IncrementalSet.h"
+
 #include "Gaffer/Context.h"
 
 using namespace std;
@@ -254,48 +256,73 @@ void Prune::hashSet( const IECore::InternedString &setName, const Gaffer::Contex
 IECore::ConstPathMatcherDataPtr Prune::computeSet( const IECore::InternedString &setName, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
 	ConstPathMatcherDataPtr inputSetData = inPlug()->setPlug()->getValue();
-	const PathMatcher &inputSet = inputSetData->readable();
-	if( inputSet.isEmpty() )
+	if( inputSetData->readable().isEmpty() )
 	{
 		return inputSetData;
 	}
 
-	PathMatcherDataPtr outputSetData = inputSetData->copy();
-	PathMatcher &outputSet = outputSetData->writable();
-
 	FilterPlug::SceneScope sceneScope( context, inPlug() );
+	sceneScope.remove( ScenePlug::scenePathContextName );
 	sceneScope.remove( ScenePlug::setNameContextName );
 
-	for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; )
-	{
-		sceneScope.set( ScenePlug::scenePathContextName, &(*pIt) );
-		const int m = filterPlug()->getValue();
-		if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
-		{
-			// This path and all below it are pruned, so we can
-			// ignore it and prune the traversal to the descendant
-			// paths.
-			outputSet.prune( *pIt );
-			pIt.prune();
-			++pIt;
-		}
-		else if( m & IECore::PathMatcher::DescendantMatch )
-		{
-			// This path isn't pruned, so we continue our traversal
-			// as normal to find out which descendants _are_ pruned.
-			++pIt;
-		}
-		else
-		{
-			// This path isn't pruned, and neither is anything
-			// below it. We can avoid retesting the filter for
-			// all descendant paths, since we know they're not
-			// pruned.
-			assert( m == IECore::PathMatcher::NoMatch );
-			pIt.prune();
-			++pIt;
-		}
-	}
+	// The filter hash represents the effect of the filter across the whole
+	// scene (see `hashSet()`), so along with the set name it identifies
+	// everything except the input set that our result depends on. This
+	// lets us patch the result from a previous frame when only the input
+	// set has changed. We key on our type rather than our address, so
+	// that entries can't be reused by another node allocated at the same
+	// address, and can be shared by identical Prunes.
+	IECore::MurmurHash key;
+	key.append( (uint64_t)staticTypeId() );
+	key.append( setName );
+	filterPlug()->hash( key );
+
+	return Private::IncrementalSet::filter(
+		key, inputSetData,
+		// Keep
+		[&] ( const ScenePlug::ScenePath &path ) {
+			sceneScope.set( ScenePlug::scenePathContextName, &path );
+			return !( filterPlug()->getValue() & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) );
+		},
+		// Compute
+		[&] ( const PathMatcherData *inputSetData ) -> ConstPathMatcherDataPtr {
+
+			const PathMatcher &inputSet = inputSetData->readable();
+			PathMatcherDataPtr outputSetData = inputSetData->copy();
+			PathMatcher &outputSet = outputSetData->writable();
+
+			for( PathMatcher::RawIterator pIt = inputSet.begin(), peIt = inputSet.end(); pIt != peIt; )
+			{
+				sceneScope.set( ScenePlug::scenePathContextName, &(*pIt) );
+				const int m = filterPlug()->getValue();
+				if( m & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::AncestorMatch ) )
+				{
+					// This path and all below it are pruned, so we can
+					// ignore it and prune the traversal to the descendant
+					// paths.
+					outputSet.prune( *pIt );
+					pIt.prune();
+					++pIt;
+				}
+				else if( m & IECore::PathMatcher::DescendantMatch )
+				{
+					// This path isn't pruned, so we continue our traversal
+					// as normal to find out which descendants _are_ pruned.
+					++pIt;
+				}
+				else
+				{
+					// This path isn't pruned, and neither is anything
+					// below it. We can avoid retesting the filter for
+					// all descendant paths, since we know they're not
+					// pruned.
+					assert( m == IECore::PathMatcher::NoMatch );
+					pIt.prune();
+					++pIt;
+				}
+			}
 
-	return outputSetData;
+			return outputSetData;
+		}
+	);
 }
@@ -239,6 +239,11 @@ void Render::executeSequence( const std::vector<float> &frames ) const
 {
 	Context::EditableScope frameScope( Context::current() );
 
+	// The renderer itself must be recreated for each frame, but
+	// the render sets can be carried over, and updated to include
+	// only the changes from one frame to the next.
+	std::unique_ptr<GafferScene::Private::RendererAlgo::RenderSets> renderSets;
+
 	for( auto frame : frames )
 	{
 		frameScope.setFrame( frame );
@@ -247,11 +252,14 @@ void Render::executeSequence( const std::vector<float> &frames ) const
 		// each time. We assume that if renders have been batched, they are
 		// lightweight in the first place (otherwise there is little benefit
 		// in sharing the startup cost between several of them).
-		executeInternal( /* flushCaches = */ frames.size() == 1 );
+		executeInternal(
+			/* flushCaches = */ frames.size() == 1,
+			/* renderSets = */ frames.size() > 1 ? &renderSets : nullptr
+		);
 	}
 }
 
-void Render::executeInternal( bool flushCaches ) const
+void Render::executeInternal( bool flushCaches, std::unique_ptr<GafferScene::Private::RendererAlgo::RenderSets> *renderSets ) const
 {
 	if( inPlug()->source()->direction() != Plug::Out )
 	{
@@ -318,15 +326,31 @@ void Render::executeInternal( bool flushCaches ) const
 
 	{
 		// Using nested scope so that we free the memory used by `renderSets`
-		// and `lightLinks` before we call `render()`.
-		GafferScene::Private::RendererAlgo::RenderSets renderSets( adaptedInPlug() );
+		// and `lightLinks` before we call `render()`, unless we have been
+		// asked to keep the sets for the next frame.
+		std::unique_ptr<GafferScene::Private::RendererAlgo::RenderSets> localRenderSets;
+		if( !renderSets )
+		{
+			renderSets = &localRenderSets;
+		}
+
+		if( *renderSets )
+		{
+			(*renderSets)->update( adaptedInPlug() );
+		}
+		else
+		{
+			*renderSets = std::make_unique<GafferScene::Private::RendererAlgo::RenderSets>( adaptedInPlug() );
+		}
+
 		GafferScene::Private::RendererAlgo::LightLinks lightLinks;
+		IECoreScenePreview::AttributesCachePtr attributesCache = new IECoreScenePreview::AttributesCache( renderer.get() );
 
-		GafferScene::Private::RendererAlgo::outputCameras( adaptedInPlug(), renderOptions, renderSets, renderer.get() );
-		GafferScene::Private::RendererAlgo::outputLights( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
-		GafferScene::Private::RendererAlgo::outputLightFilters( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
+		GafferScene::Private::RendererAlgo::outputCameras( adaptedInPlug(), renderOptions, **renderSets, renderer.get(), attributesCache.get() );
+		GafferScene::Private::RendererAlgo::outputLights( adaptedInPlug(), renderOptions, **renderSets, &lightLinks, renderer.get(), attributesCache.get() );
+		GafferScene::Private::RendererAlgo::outputLightFilters( adaptedInPlug(), renderOptions, **renderSets, &lightLinks, renderer.get(), attributesCache.get() );
 		lightLinks.outputLightFilterLinks( adaptedInPlug() );
-		GafferScene::Private::RendererAlgo::outputObjects( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
+		GafferScene::Private::RendererAlgo::outputObjects( adaptedInPlug(), renderOptions, **renderSets, &lightLinks, renderer.get(), ScenePlug::ScenePath(), attributesCache.get() );
 	}
 
 	if( renderScope.sceneTranslationOnly() )
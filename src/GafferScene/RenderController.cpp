@@ -37,6 +37,7 @@
 #include "GafferScene/RenderController.h"
 
 #include "GafferScene/Capsule.h"
+#include "GafferScene/Private/ChangeJournal.h"
 #include "GafferScene/Private/IECoreScenePreview/Placeholder.h"
 #include "GafferScene/SceneAlgo.h"
 
@@ -55,7 +56,9 @@
 #include "boost/multi_index/ordered_index.hpp"
 #include "boost/multi_index_container.hpp"
 
-#include "tbb/task.h"
+#include "tbb/parallel_for.h"
+#include "tbb/spin_rw_mutex.h"
+#include "tbb/task_group.h"
 
 #include "fmt/format.h"
 
@@ -339,7 +342,7 @@ class RenderController::SceneGraph
 		// Constructs the root of the scene graph.
 		// Children are constructed using updateChildren().
 		SceneGraph()
-			:	m_parent( nullptr ), m_fullAttributes( new CompoundObject ), m_purposeIncluded( true ), m_dirtyComponents( AllComponents ), m_changedComponents( NoComponent )
+			:	m_parent( nullptr ), m_fullAttributes( new CompoundObject ), m_purposeIncluded( true ), m_dirtyComponents( AllComponents ), m_locallyDirtyComponents( NoComponent ), m_changedComponents( NoComponent )
 		{
 			clear();
 		}
@@ -356,17 +359,43 @@ class RenderController::SceneGraph
 
 		void dirty( unsigned components )
 		{
-			if( ( components & m_dirtyComponents ) == components )
+			if( ( components & m_dirtyComponents & ~m_locallyDirtyComponents ) == components )
 			{
+				// Already dirty, and so are all our descendants.
 				return;
 			}
 			m_dirtyComponents |= components;
+			m_locallyDirtyComponents &= ~components;
 			for( const auto &c : m_children )
 			{
 				c->dirty( components );
 			}
 		}
 
+		// Dirties only the locations matching `paths` and their descendants.
+		// Ancestors of matching locations are also dirtied, but without
+		// dirtying their other descendants.
+		void dirty( unsigned components, const IECore::PathMatcher &paths, ScenePlug::ScenePath &path )
+		{
+			const unsigned m = paths.match( path );
+			if( m & PathMatcher::ExactMatch )
+			{
+				dirty( components );
+			}
+			else if( m & PathMatcher::DescendantMatch )
+			{
+				m_locallyDirtyComponents |= components & ~m_dirtyComponents;
+				m_dirtyComponents |= components;
+				path.push_back( InternedString() );
+				for( const auto &c : m_children )
+				{
+					path.back() = c->name();
+					c->dirty( components, paths, path );
+				}
+				path.pop_back();
+			}
+		}
+
 		// Called by SceneGraphUpdateTask to update this location. Returns true if
 		// anything changed.
 		bool update( const ScenePlug::ScenePath &path, unsigned changedGlobals, Type type, RenderController *controller )
@@ -487,7 +516,7 @@ class RenderController::SceneGraph
 				m_objectHash = MurmurHash();
 			}
 
-			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get() ) )
+			if( ( m_dirtyComponents & ObjectComponent ) && updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_attributesCache.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get() ) )
 			{
 				m_changedComponents |= ObjectComponent;
 			}
@@ -499,7 +528,7 @@ class RenderController::SceneGraph
 					// Apply attribute update to old object if necessary.
 					if( m_changedComponents & AttributesComponent )
 					{
-						if( m_objectInterface->attributes( attributesInterface( controller->m_renderer.get() ) ) )
+						if( m_objectInterface->attributes( attributesInterface( controller->m_attributesCache.get() ) ) )
 						{
 							// Update succeeded. Update light filter links if necessary.
 							if( type == LightFilterType && controller->m_lightLinks )
@@ -511,7 +540,7 @@ class RenderController::SceneGraph
 						{
 							// Failed to apply attributes - must replace entire object.
 							m_objectHash = MurmurHash();
-							if( updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get() ) )
+							if( updateObject( controller->m_scene->objectPlug(), type, controller->m_renderer.get(), controller->m_attributesCache.get(), controller->m_renderOptions, controller->m_scene.get(), controller->m_lightLinks.get() ) )
 							{
 								m_changedComponents |= ObjectComponent;
 								controller->m_failedAttributeEdits++;
@@ -555,6 +584,12 @@ class RenderController::SceneGraph
 					// Apply light links if necessary.
 					if( m_changedComponents & ( ObjectComponent | AttributesComponent ) || controller->m_lightLinks->lightLinksDirty() )
 					{
+						if( m_changedComponents & ObjectComponent )
+						{
+							// New object, which needs linking even if the
+							// links are the same as for the old one.
+							m_lightLinksHash = IECore::MurmurHash();
+						}
 						controller->m_lightLinks->outputLightLinks( controller->m_scene.get(), m_fullAttributes.get(), m_objectInterface.get(), &m_lightLinksHash );
 					}
 				}
@@ -668,6 +703,7 @@ class RenderController::SceneGraph
 			m_drawMode = VisibleSet::Visibility::None;
 			m_boundInterface = nullptr;
 			m_dirtyComponents = AllComponents;
+			m_locallyDirtyComponents = NoComponent;
 		}
 
 		// Returns true if the location has not been finalised
@@ -746,11 +782,11 @@ class RenderController::SceneGraph
 			return true;
 		}
 
-		IECoreScenePreview::Renderer::AttributesInterface *attributesInterface( IECoreScenePreview::Renderer *renderer )
+		IECoreScenePreview::Renderer::AttributesInterface *attributesInterface( IECoreScenePreview::AttributesCache *attributesCache )
 		{
 			if( !m_attributesInterface )
 			{
-				m_attributesInterface = renderer->attributes( m_fullAttributes.get() );
+				m_attributesInterface = attributesCache->get( m_fullAttributes.get() );
 			}
 			return m_attributesInterface.get();
 		}
@@ -803,7 +839,7 @@ class RenderController::SceneGraph
 		}
 
 		// Returns true if the object changed.
-		bool updateObject( const ObjectPlug *objectPlug, Type type, IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const ScenePlug *scene, LightLinks *lightLinks )
+		bool updateObject( const ObjectPlug *objectPlug, Type type, IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const ScenePlug *scene, LightLinks *lightLinks )
 		{
 			const bool hadObjectInterface = static_cast<bool>( m_objectInterface );
 			if( type == NoType || m_drawMode != VisibleSet::Visibility::Visible || !m_purposeIncluded )
@@ -834,7 +870,7 @@ class RenderController::SceneGraph
 				ScenePlug::pathToString( Context::current()->get<vector<InternedString> >( ScenePlug::scenePathContextName ), name );
 				if( type == LightType )
 				{
-					auto light = renderer->light( name, nullObject ? nullptr : object.get(), attributesInterface( renderer ) );
+					auto light = renderer->light( name, nullObject ? nullptr : object.get(), attributesInterface( attributesCache ) );
 					if( light && lightLinks )
 					{
 						lightLinks->addLight( name, light );
@@ -852,7 +888,7 @@ class RenderController::SceneGraph
 				}
 				else
 				{
-					auto lightFilter = renderer->lightFilter( name, nullObject ? nullptr : object.get(), attributesInterface( renderer ) );
+					auto lightFilter = renderer->lightFilter( name, nullObject ? nullptr : object.get(), attributesInterface( attributesCache ) );
 					if( lightFilter && lightLinks )
 					{
 						lightLinks->addLightFilter( lightFilter, m_fullAttributes.get() );
@@ -946,7 +982,7 @@ class RenderController::SceneGraph
 						m_objectInterface = renderer->camera(
 							name,
 							cameraSamples[0].get(),
-							attributesInterface( renderer )
+							attributesInterface( attributesCache )
 						);
 					}
 					else
@@ -960,7 +996,7 @@ class RenderController::SceneGraph
 							name,
 							rawCameraSamples,
 							m_deformationTimes,
-							attributesInterface( renderer )
+							attributesInterface( attributesCache )
 						);
 					}
 				}
@@ -982,7 +1018,7 @@ class RenderController::SceneGraph
 						sample = capsuleCopy;
 					}
 					m_objectInterface.assign(
-						renderer->object( name, sample.get(), attributesInterface( renderer ) ),
+						renderer->object( name, sample.get(), attributesInterface( attributesCache ) ),
 						ObjectInterfaceHandle::RemovalCallback(),
 						/* isCapsule = */ runTimeCast<const Capsule>( sample.get() )
 					);
@@ -995,7 +1031,7 @@ class RenderController::SceneGraph
 					{
 						objectsVector.push_back( sample.get() );
 					}
-					m_objectInterface = renderer->object( name, objectsVector, m_deformationTimes, attributesInterface( renderer ) );
+					m_objectInterface = renderer->object( name, objectsVector, m_deformationTimes, attributesInterface( attributesCache ) );
 				}
 			}
 
@@ -1101,6 +1137,7 @@ class RenderController::SceneGraph
 		void clean( unsigned components )
 		{
 			m_dirtyComponents &= ~components;
+			m_locallyDirtyComponents &= ~components;
 		}
 
 		M44f fullTransform( float time ) const
@@ -1164,6 +1201,9 @@ class RenderController::SceneGraph
 		// Tracks work which needs to be done on
 		// the next call to `update()`.
 		unsigned m_dirtyComponents;
+		// The subset of `m_dirtyComponents` which has
+		// not been propagated to our descendants.
+		unsigned m_locallyDirtyComponents;
 		// Tracks things that were changed on the last
 		// call to `update()`. This is needed in two
 		// scenarios :
@@ -1187,8 +1227,9 @@ class RenderController::SceneGraph
 
 };
 
-// TBB task used to perform multithreaded updates on our SceneGraph.
-class RenderController::SceneGraphUpdateTask : public tbb::task
+// Performs multithreaded updates on our SceneGraph, recursing to the
+// children of each location in parallel.
+class RenderController::SceneGraphUpdateTask
 {
 
 	public :
@@ -1201,7 +1242,8 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			const ThreadState &threadState,
 			const ScenePlug::ScenePath &scenePath,
 			const ProgressCallback &callback,
-			const PathMatcher *pathsToUpdate
+			const PathMatcher *pathsToUpdate,
+			tbb::task_group_context &taskGroupContext
 		)
 			:	m_controller( controller ),
 				m_sceneGraph( sceneGraph ),
@@ -1210,17 +1252,18 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				m_threadState( threadState ),
 				m_scenePath( scenePath ),
 				m_callback( callback ),
-				m_pathsToUpdate( pathsToUpdate )
+				m_pathsToUpdate( pathsToUpdate ),
+				m_taskGroupContext( taskGroupContext )
 		{
 		}
 
-		task *execute() override
+		void execute()
 		{
 
 			const unsigned pathsToUpdateMatch = m_pathsToUpdate ? m_pathsToUpdate->match( m_scenePath ) : (unsigned)PathMatcher::EveryMatch;
 			if( !pathsToUpdateMatch )
 			{
-				return nullptr;
+				return;
 			}
 
 			// Figure out if this location belongs in the type
@@ -1232,7 +1275,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			if( !( sceneGraphMatch & ( IECore::PathMatcher::ExactMatch | IECore::PathMatcher::DescendantMatch ) ) )
 			{
 				m_sceneGraph->clear();
-				return nullptr;
+				return;
 			}
 
 			// Set up a context to compute the scene at the right
@@ -1254,23 +1297,25 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 				m_callback( BackgroundTask::Running );
 			}
 
-			// Spawn subtasks to apply updates to each child.
+			// Apply updates to each child in parallel.
 
 			const auto &children = m_sceneGraph->children();
 			if( m_sceneGraph->expanded() && children.size() )
 			{
-				set_ref_count( 1 + children.size() );
-
-				ScenePlug::ScenePath childPath = m_scenePath;
-				childPath.push_back( IECore::InternedString() ); // space for the child name
-				for( const auto &child : children )
-				{
-					childPath.back() = child->name();
-					SceneGraphUpdateTask *t = new( allocate_child() ) SceneGraphUpdateTask( m_controller, child.get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate );
-					spawn( *t );
-				}
-
-				wait_for_all();
+				tbb::parallel_for(
+					tbb::blocked_range<size_t>( 0, children.size() ),
+					[&] ( const tbb::blocked_range<size_t> &range ) {
+						ScenePlug::ScenePath childPath = m_scenePath;
+						childPath.push_back( IECore::InternedString() ); // space for the child name
+						for( size_t i = range.begin(); i != range.end(); ++i )
+						{
+							childPath.back() = children[i]->name();
+							SceneGraphUpdateTask childTask( m_controller, children[i].get(), m_sceneGraphType, m_changedGlobalComponents, m_threadState, childPath, m_callback, m_pathsToUpdate, m_taskGroupContext );
+							childTask.execute();
+						}
+					},
+					m_taskGroupContext
+				);
 			}
 			else
 			{
@@ -1284,8 +1329,6 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 			{
 				m_sceneGraph->allChildrenUpdated();
 			}
-
-			return nullptr;
 		}
 
 	private :
@@ -1332,6 +1375,7 @@ class RenderController::SceneGraphUpdateTask : public tbb::task
 		ScenePlug::ScenePath m_scenePath;
 		const ProgressCallback &m_callback;
 		const PathMatcher *m_pathsToUpdate;
+		tbb::task_group_context &m_taskGroupContext;
 
 };
 
@@ -1346,6 +1390,8 @@ RenderController::RenderController( const ConstScenePlugPtr &scene, const Gaffer
 		m_updateRequired( false ),
 		m_updateRequested( false ),
 		m_failedAttributeEdits( 0 ),
+		m_changeJournal( std::make_unique<Private::ChangeJournal>() ),
+		m_dirtyPathsValid( false ),
 		m_dirtyGlobalComponents( NoGlobalComponent ),
 		m_changedGlobalComponents( NoGlobalComponent )
 {
@@ -1361,6 +1407,8 @@ RenderController::RenderController( const ConstScenePlugPtr &scene, const Gaffer
 		m_lightLinks = std::make_unique<LightLinks>();
 	}
 
+	m_attributesCache = new IECoreScenePreview::AttributesCache( m_renderer.get() );
+
 	IECore::CompoundObjectPtr defaultAttributes = new CompoundObject();
 	m_defaultAttributes = m_renderer->attributes( defaultAttributes.get() );
 
@@ -1377,6 +1425,7 @@ RenderController::~RenderController()
 	// is destroyed.
 	m_renderer->pause();
 	m_sceneGraphs.clear();
+	m_attributesCache.reset();
 	m_defaultCamera.reset();
 	m_lightLinks.reset();
 }
@@ -1485,25 +1534,38 @@ bool RenderController::updateRequired() const
 
 void RenderController::plugDirtied( const Gaffer::Plug *plug )
 {
+	unsigned components = SceneGraph::NoComponent;
 	if( plug == m_scene->boundPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::BoundComponent );
+		components = SceneGraph::BoundComponent;
 	}
 	else if( plug == m_scene->transformPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::TransformComponent );
+		components = SceneGraph::TransformComponent;
 	}
 	else if( plug == m_scene->attributesPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::AttributesComponent );
+		components = SceneGraph::AttributesComponent;
 	}
 	else if( plug == m_scene->objectPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::ObjectComponent );
+		components = SceneGraph::ObjectComponent;
 	}
 	else if( plug == m_scene->childNamesPlug() )
 	{
-		dirtySceneGraphs( SceneGraph::ChildNamesComponent );
+		components = SceneGraph::ChildNamesComponent;
+	}
+
+	if( components != SceneGraph::NoComponent )
+	{
+		if( auto paths = m_changeJournal->affectedPaths( static_cast<const ValuePlug *>( plug ) ) )
+		{
+			dirtySceneGraphs( components, *paths );
+		}
+		else
+		{
+			dirtySceneGraphs( components );
+		}
 	}
 	else if( plug == m_scene->globalsPlug() )
 	{
@@ -1555,6 +1617,8 @@ void RenderController::dirtySceneGraphs( unsigned components )
 		sg->dirty( components );
 	}
 
+	m_dirtyPathsValid = false;
+
 	if( components & SceneGraph::ObjectComponent )
 	{
 		// Changes to a camera object may include changing the
@@ -1563,6 +1627,25 @@ void RenderController::dirtySceneGraphs( unsigned components )
 	}
 }
 
+void RenderController::dirtySceneGraphs( unsigned components, const IECore::PathMatcher &paths )
+{
+	ScenePlug::ScenePath path;
+	for( auto &sg : m_sceneGraphs )
+	{
+		sg->dirty( components, paths, path );
+	}
+
+	if( m_dirtyPathsValid )
+	{
+		m_dirtyPaths.addPaths( paths );
+	}
+
+	if( components & SceneGraph::ObjectComponent )
+	{
+		m_dirtyGlobalComponents |= CameraShutterGlobalComponent;
+	}
+}
+
 void RenderController::update( const ProgressCallback &callback )
 {
 	if( !m_scene || !m_context )
@@ -1571,6 +1654,7 @@ void RenderController::update( const ProgressCallback &callback )
 	}
 
 	m_updateRequested = false;
+	m_changeJournal->clear();
 
 	Context::EditableScope scopedContext( m_context.get() );
 	scopedContext.set( "scene:renderer", &m_renderer->name().string() );
@@ -1587,6 +1671,7 @@ std::shared_ptr<Gaffer::BackgroundTask> RenderController::updateInBackground( co
 
 	m_updateRequested = false;
 	cancelBackgroundTask();
+	m_changeJournal->clear();
 
 	Context::EditableScope scopedContext( m_context.get() );
 	scopedContext.set( "scene:renderer", &m_renderer->name().string() );
@@ -1684,31 +1769,68 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 
 		m_dirtyGlobalComponents = NoGlobalComponent;
 
+		// If we know which locations have been affected by edits, then we
+		// only need to visit those, unless global changes require a visit
+		// to every location.
+
+		const PathMatcher *traversalPaths = pathsToUpdate;
+		if( !pathsToUpdate && m_dirtyPathsValid && m_changedGlobalComponents == NoGlobalComponent )
+		{
+			traversalPaths = &m_dirtyPaths;
+		}
+
 		// Update scene graphs
 
-		for( int i = SceneGraph::FirstType; i <= SceneGraph::LastType; ++i )
+		if( m_changedGlobalComponents & CameraOptionsGlobalComponent )
 		{
-			SceneGraph *sceneGraph = m_sceneGraphs[i].get();
-			if( i == SceneGraph::CameraType && ( m_changedGlobalComponents & CameraOptionsGlobalComponent ) )
-			{
-				// Because the globals are applied to camera objects, we must update the object whenever
-				// the globals have changed, so we clear the scene graph and start again.
-				/// \todo Can we do better here, by using m_changedGlobalComponents in `SceneGraph::update()`?
-				sceneGraph->clear();
-			}
+			// Because the globals are applied to camera objects, we must update the object whenever
+			// the globals have changed, so we clear the scene graph and start again.
+			/// \todo Can we do better here, by using m_changedGlobalComponents in `SceneGraph::update()`?
+			m_sceneGraphs[SceneGraph::CameraType]->clear();
+		}
 
+		const ThreadState &threadState = ThreadState::current();
+		auto updateSceneGraph = [&] ( SceneGraph::Type type, const PathMatcher *paths ) {
+			// Each type gets its own isolated context, so that an exception
+			// from one is not rethrown by the traversals of the others, and
+			// so that outer tasks can't silently cancel our tasks.
 			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
-			SceneGraphUpdateTask *task = new( tbb::task::allocate_root( taskGroupContext ) ) SceneGraphUpdateTask(
-				this, sceneGraph, (SceneGraph::Type)i, m_changedGlobalComponents, ThreadState::current(), ScenePlug::ScenePath(), callback, pathsToUpdate
+			SceneGraphUpdateTask task(
+				this, m_sceneGraphs[type].get(), type, m_changedGlobalComponents, threadState, ScenePlug::ScenePath(), callback, paths, taskGroupContext
 			);
-			tbb::task::spawn_root_and_wait( *task );
+			task.execute();
+		};
 
-			if( i == SceneGraph::LightFilterType && m_lightLinks && m_lightLinks->lightFilterLinksDirty() )
-			{
-				m_lightLinks->outputLightFilterLinks( m_scene.get() );
-			}
+		// Cameras, lights and light filters don't depend on one another, so
+		// we update them concurrently. This avoids leaving cores idle while
+		// a pass over a few expensive locations completes.
+
+		tbb::task_group taskGroup;
+		taskGroup.run( [&] { updateSceneGraph( SceneGraph::CameraType, traversalPaths ); } );
+		taskGroup.run( [&] { updateSceneGraph( SceneGraph::LightFilterType, traversalPaths ); } );
+		taskGroup.run( [&] { updateSceneGraph( SceneGraph::LightType, traversalPaths ); } );
+		taskGroup.wait();
+
+		// Filter links require both lights and light filters, and objects
+		// are linked to lights, so must be output last. This also preserves
+		// the guarantee that cameras and lights are output before the rest
+		// of the scene, which some renderer backends rely on.
+
+		if( m_lightLinks && m_lightLinks->lightFilterLinksDirty() )
+		{
+			m_lightLinks->outputLightFilterLinks( m_scene.get() );
+		}
+
+		// If lights have been added or removed, or light linking expressions
+		// need reevaluating, then all objects may need relinking.
+
+		if( traversalPaths != pathsToUpdate && m_lightLinks && m_lightLinks->lightLinksDirty() )
+		{
+			traversalPaths = pathsToUpdate;
 		}
 
+		updateSceneGraph( SceneGraph::ObjectType, traversalPaths );
+
 		if( m_changedGlobalComponents & CameraOptionsGlobalComponent )
 		{
 			updateDefaultCamera();
@@ -1720,6 +1842,8 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			// know our entire scene has been updated successfully.
 			m_changedGlobalComponents = NoGlobalComponent;
 			m_updateRequired = false;
+			m_dirtyPaths = PathMatcher();
+			m_dirtyPathsValid = true;
 			if( m_failedAttributeEdits )
 			{
 				IECore::msg(
@@ -1735,6 +1859,9 @@ void RenderController::updateInternal( const ProgressCallback &callback, const I
 			{
 				m_lightLinks->clean();
 			}
+			// Release attributes which are no longer used by any location,
+			// so they can be freed by the renderer.
+			m_attributesCache->clearUnused();
 		}
 
 		if( callback && signalCompletion )
@@ -69,6 +69,7 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <filesystem>
 
 using namespace std;
@@ -156,6 +157,31 @@ InternedString g_deformationBlurSegmentsAttributeName( "gaffer:deformationBlurSe
 static BoolDataPtr g_true = new BoolData( true );
 static BoolDataPtr g_false = new BoolData( false );
 
+// Calls `f( i )` for each index into `sampleTimes`, with the frame set to
+// `sampleTimes[i]` in the current context. Samples are evaluated in parallel,
+// because each may require an expensive computation, such as a read from a
+// geometry cache. It is the responsibility of `f` to store its results by
+// index, so that the output doesn't depend on the order of evaluation. Indices
+// before `begin` are skipped.
+template<typename F>
+void parallelForSampleTimes( const std::vector<float> &sampleTimes, F &&f, size_t begin = 0 )
+{
+	const ThreadState &threadState = ThreadState::current();
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( begin, sampleTimes.size(), 1 ),
+		[&] ( const tbb::blocked_range<size_t> &range ) {
+			Context::EditableScope timeContext( threadState );
+			for( size_t i = range.begin(); i != range.end(); ++i )
+			{
+				timeContext.setFrame( sampleTimes[i] );
+				f( i );
+			}
+		},
+		taskGroupContext
+	);
+}
+
 } // namespace
 
 namespace GafferScene
@@ -240,22 +266,15 @@ bool transformSamples( const M44fPlug *transformPlug, const std::vector<float> &
 	}
 	else
 	{
-		Context::EditableScope timeContext( Context::current() );
-
-		bool moving = false;
-		sampleHashes.reserve( sampleTimes.size() );
-		for( const float sampleTime : sampleTimes )
-		{
-			timeContext.setFrame( sampleTime );
-			IECore::MurmurHash h = transformPlug->hash();
-			if( !moving && !sampleHashes.empty() && h != sampleHashes.front() )
-			{
-				moving = true;
+		sampleHashes.resize( sampleTimes.size() );
+		parallelForSampleTimes(
+			sampleTimes,
+			[&] ( size_t i ) {
+				sampleHashes[i] = transformPlug->hash();
 			}
-			sampleHashes.push_back( h );
-		}
+		);
 
-		if( !moving )
+		if( std::all_of( sampleHashes.begin(), sampleHashes.end(), [&] ( const IECore::MurmurHash &h ) { return h == sampleHashes.front(); } ) )
 		{
 			sampleHashes.resize( 1 );
 		}
@@ -299,21 +318,15 @@ bool transformSamples( const M44fPlug *transformPlug, const std::vector<float> &
 	else
 	{
 		// Motion case
-		Context::EditableScope timeContext( Context::current() );
-		bool moving = false;
-		samples.reserve( sampleTimes.size() );
-		for( size_t i = 0; i < sampleTimes.size(); i++ )
-		{
-			timeContext.setFrame( sampleTimes[i] );
-			const M44f m = transformPlug->getValue( &sampleHashes[i] );
-			if( !moving && !samples.empty() && m != samples.front() )
-			{
-				moving = true;
+		samples.resize( sampleTimes.size() );
+		parallelForSampleTimes(
+			sampleTimes,
+			[&] ( size_t i ) {
+				samples[i] = transformPlug->getValue( &sampleHashes[i] );
 			}
-			samples.push_back( m );
-		}
+		);
 
-		if( !moving )
+		if( std::all_of( samples.begin(), samples.end(), [&] ( const M44f &m ) { return m == samples.front(); } ) )
 		{
 			samples.resize( 1 );
 		}
@@ -336,24 +349,15 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 	}
 	else
 	{
-		const Context *frameContext = Context::current();
-		Context::EditableScope timeContext( frameContext );
-
-		bool moving = false;
-		sampleHashes.reserve( sampleTimes.size() );
-		for( const float sampleTime : sampleTimes )
-		{
-			timeContext.setFrame( sampleTime );
-
-			const MurmurHash objectHash = objectPlug->hash();
-			if( !moving && !sampleHashes.empty() && objectHash != sampleHashes.front() )
-			{
-				moving = true;
+		sampleHashes.resize( sampleTimes.size() );
+		parallelForSampleTimes(
+			sampleTimes,
+			[&] ( size_t i ) {
+				sampleHashes[i] = objectPlug->hash();
 			}
-			sampleHashes.push_back( objectHash );
-		}
+		);
 
-		if( !moving )
+		if( std::all_of( sampleHashes.begin(), sampleHashes.end(), [&] ( const IECore::MurmurHash &h ) { return h == sampleHashes.front(); } ) )
 		{
 			sampleHashes.resize( 1 );
 		}
@@ -410,21 +414,40 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 	}
 	else
 	{
-		// Motion case
-		const Context *frameContext = Context::current();
-		Context::EditableScope timeContext( frameContext );
+		// Motion case. Evaluate the first sample on its own, because if it
+		// can't be interpolated we won't need the others. Then evaluate the
+		// remaining samples in parallel, and inspect them all in order.
+
+		auto interpolable = [] ( const Object *object ) {
+			return runTimeCast<const Primitive>( object ) || runTimeCast<const Camera>( object );
+		};
 
-		samples.reserve( sampleTimes.size() );
-		for( size_t i = 0; i < sampleTimes.size(); i++ )
+		std::vector<ConstObjectPtr> objects( sampleTimes.size() );
 		{
-			timeContext.setFrame( sampleTimes[i] );
+			Context::EditableScope timeContext( Context::current() );
+			timeContext.setFrame( sampleTimes[0] );
+			objects[0] = objectPlug->getValue( &sampleHashes[0] );
+		}
 
-			ConstObjectPtr object = objectPlug->getValue( &sampleHashes[i] );
+		if( interpolable( objects[0].get() ) )
+		{
+			parallelForSampleTimes(
+				sampleTimes,
+				[&] ( size_t i ) {
+					objects[i] = objectPlug->getValue( &sampleHashes[i] );
+				},
+				/* begin = */ 1
+			);
+		}
+		else
+		{
+			objects.resize( 1 );
+		}
 
-			if(
-				runTimeCast<const Primitive>( object.get() ) ||
-				runTimeCast<const Camera>( object.get() )
-			)
+		samples.reserve( objects.size() );
+		for( const auto &object : objects )
+		{
+			if( interpolable( object.get() ) )
 			{
 				samples.push_back( object.get() );
 			}
@@ -437,7 +460,6 @@ bool objectSamples( const ObjectPlug *objectPlug, const std::vector<float> &samp
 				// sample. This must be at the frame time rather than shutter
 				// open time so that non-interpolable objects appear in the right
 				// position relative to non-blurred objects.
-				Context::Scope frameScope( frameContext );
 				std::vector<float> tempTimes = {};
 
 				// Use the hash from the shutter samples. This is technically incorrect, since we are going
@@ -766,7 +788,7 @@ namespace RendererAlgo
 {
 
 LightLinks::LightLinks()
-	:	m_lightLinksDirty( true ), m_lightFilterLinksDirty( true )
+	:	m_lightsGeneration( 0 ), m_setsGeneration( 0 ), m_lightLinksDirty( true ), m_lightFilterLinksDirty( true )
 {
 }
 
@@ -777,17 +799,17 @@ void LightLinks::addLight( const std::string &path, const IECoreScenePreview::Re
 	m_lights.insert( a, path );
 	assert( !a->second ); // We expect `removeLight()` to be called before `addLight()` is called again
 	a->second = light;
+	m_lightsGeneration++;
 	m_lightLinksDirty = true;
 	m_lightFilterLinksDirty = true;
-	clearLightLinks();
 }
 
 void LightLinks::removeLight( const std::string &path )
 {
 	m_lights.erase( path );
+	m_lightsGeneration++;
 	m_lightLinksDirty = true;
 	m_lightFilterLinksDirty = true;
-	clearLightLinks();
 }
 
 void LightLinks::addLightFilter( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const IECore::CompoundObject *attributes )
@@ -875,7 +897,7 @@ void LightLinks::setsDirtied()
 	{
 		f.second.filteredLightsDirty = true;
 	}
-	clearLightLinks();
+	m_setsGeneration++;
 	m_lightLinksDirty = true;
 	m_lightFilterLinksDirty = true;
 }
@@ -892,18 +914,29 @@ bool LightLinks::lightFilterLinksDirty() const
 
 void LightLinks::clean()
 {
+	if( m_lightLinksDirty )
+	{
+		// All objects have just been relinked, revalidating the entries for
+		// every expression still in use. Remove the others, so they don't keep
+		// removed lights alive.
+		vector<string> unused;
+		for( const auto &l : m_lightLinks )
+		{
+			if( l.second.lightsGeneration != m_lightsGeneration || l.second.setsGeneration != m_setsGeneration )
+			{
+				unused.push_back( l.first );
+			}
+		}
+		for( const auto &e : unused )
+		{
+			m_lightLinks.erase( e );
+		}
+	}
+
 	m_lightLinksDirty = false;
 	m_lightFilterLinksDirty = false;
 }
 
-void LightLinks::clearLightLinks()
-{
-	// We may be called concurrently from `addLight()/removeLight()`, and
-	// `clear()` is not threadsafe - hence the mutex.
-	tbb::spin_mutex::scoped_lock l( m_lightLinksClearMutex );
-	m_lightLinks.clear();
-}
-
 std::string LightLinks::filteredLightsExpression( const IECore::CompoundObject *attributes ) const
 {
 	const StringData *d = attributes->member<StringData>( g_filteredLightsAttributeName );
@@ -917,63 +950,98 @@ void LightLinks::outputLightLinks( const ScenePlug *scene, const IECore::Compoun
 	/// or if we find we need to support other renderer-specific attributes, we
 	/// could add a mechanism for registering them.
 	const StringData *linkedShadowsExpressionData = attributes->member<StringData>( g_shadowGroupAttributeName );
-	const std::string linkedLightsExpression = linkedLightsExpressionData ? linkedLightsExpressionData->readable() : "defaultLights";
-	const std::string linkedShadowsExpression = linkedShadowsExpressionData ? linkedShadowsExpressionData->readable() : "__lights";
+	const std::string &linkedLightsExpression = linkedLightsExpressionData ? linkedLightsExpressionData->readable() : g_defaultLightsSetName.string();
+	const std::string &linkedShadowsExpression = linkedShadowsExpressionData ? linkedShadowsExpressionData->readable() : g_lightsSetName.string();
+
+	IECore::MurmurHash h;
+	IECoreScenePreview::Renderer::ConstObjectSetPtr lights = linkedLights( linkedLightsExpression, scene, h );
+	IECoreScenePreview::Renderer::ConstObjectSetPtr shadowLights = linkedLights( linkedShadowsExpression, scene, h );
 
 	if( hash )
 	{
-		IECore::MurmurHash h;
-		h.append( linkedLightsExpression );
-		h.append( linkedShadowsExpression );
-		if( !m_lightLinksDirty && *hash == h )
-		{
-			// We're only being called because the attributes have changed as a whole, but the
-			// specific attributes we care about haven't changed. No need to relink anything.
-			/// \todo Investigate other optimisations. Perhaps `setExpressionHash()` is fast enough
-			/// that we could use it to avoid editing links when sets have been dirtied but the
-			/// specific sets we care about haven't changed?
+		if( *hash == h )
+		{
+			// The links are identical to the ones we output last time. This
+			// is the common case when attributes or sets have changed, but
+			// not in a way that affects linking.
 			return;
 		}
 		*hash = h;
 	}
 
-	IECoreScenePreview::Renderer::ConstObjectSetPtr objectSet = linkedLights( linkedLightsExpression, scene );
-	object->link( g_lights, objectSet );
-	objectSet = linkedLights( linkedShadowsExpression, scene );
-	object->link( g_shadowGroupAttributeName, objectSet );
+	object->link( g_lights, lights );
+	object->link( g_shadowGroupAttributeName, shadowLights );
 }
 
-IECoreScenePreview::Renderer::ConstObjectSetPtr LightLinks::linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene ) const
+IECoreScenePreview::Renderer::ConstObjectSetPtr LightLinks::linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene, IECore::MurmurHash &linkHash ) const
 {
-	LightLinkMap::accessor a;
-	if( !m_lightLinks.insert( a, linkedLightsExpression ) )
-	{
-		// Already did the work
-		return a->second;
-	}
+	linkHash.append( linkedLightsExpression );
+
+	const uint64_t lightsGeneration = m_lightsGeneration;
+	const uint64_t setsGeneration = m_setsGeneration;
 
-	PathMatcher paths = SetAlgo::evaluateSetExpression( linkedLightsExpression, scene );
+	// Fast path, taking only a read lock, so that the many objects typically
+	// sharing the same expression don't contend with each other.
 
-	auto objectSet = std::make_shared<IECoreScenePreview::Renderer::ObjectSet>();
-	for( PathMatcher::Iterator it = paths.begin(), eIt = paths.end(); it != eIt; ++it )
 	{
-		std::string pathString;
-		ScenePlug::pathToString( *it, pathString );
-		LightMap::const_accessor a;
-		if( m_lights.find( a, pathString ) )
+		LightLinkMap::const_accessor readAccessor;
+		if(
+			m_lightLinks.find( readAccessor, linkedLightsExpression ) &&
+			readAccessor->second.lightsGeneration == lightsGeneration &&
+			readAccessor->second.setsGeneration == setsGeneration
+		)
 		{
-			objectSet->insert( a->second );
+			linkHash.append( readAccessor->second.version );
+			return readAccessor->second.lights;
 		}
 	}
-	if( objectSet->size() == m_lights.size() )
+
+	// Slow path. The first thread to get here computes the
+	// result while others wait.
+
+	LightLinkMap::accessor a;
+	const bool inserted = m_lightLinks.insert( a, linkedLightsExpression );
+	LightLink &lightLink = a->second;
+
+	if( inserted || lightLink.lightsGeneration != lightsGeneration || lightLink.setsGeneration != setsGeneration )
 	{
-		// All lights are linked, in which case we can avoid
-		// explicitly listing all the links as an optimisation.
-		objectSet = nullptr;
+		const IECore::MurmurHash setExpressionHash = SetAlgo::setExpressionHash( linkedLightsExpression, scene );
+		if( inserted || lightLink.lightsGeneration != lightsGeneration || lightLink.setExpressionHash != setExpressionHash )
+		{
+			PathMatcher paths = SetAlgo::evaluateSetExpression( linkedLightsExpression, scene );
+
+			auto objectSet = std::make_shared<IECoreScenePreview::Renderer::ObjectSet>();
+			for( PathMatcher::Iterator it = paths.begin(), eIt = paths.end(); it != eIt; ++it )
+			{
+				std::string pathString;
+				ScenePlug::pathToString( *it, pathString );
+				LightMap::const_accessor lightAccessor;
+				if( m_lights.find( lightAccessor, pathString ) )
+				{
+					objectSet->insert( lightAccessor->second );
+				}
+			}
+			if( objectSet->size() == m_lights.size() )
+			{
+				// All lights are linked, in which case we can avoid
+				// explicitly listing all the links as an optimisation.
+				objectSet = nullptr;
+			}
+
+			const bool changed = inserted || ( objectSet && lightLink.lights ? *objectSet != *lightLink.lights : objectSet != lightLink.lights );
+			if( changed )
+			{
+				lightLink.lights = objectSet;
+				lightLink.version++;
+			}
+			lightLink.setExpressionHash = setExpressionHash;
+		}
+		lightLink.lightsGeneration = lightsGeneration;
+		lightLink.setsGeneration = setsGeneration;
 	}
 
-	a->second = objectSet;
-	return a->second;
+	linkHash.append( lightLink.version );
+	return lightLink.lights;
 }
 
 void LightLinks::outputLightFilterLinks( const ScenePlug *scene )
@@ -1094,8 +1162,8 @@ IECore::InternedString optionName( const IECore::InternedString &globalsName )
 struct LocationOutput
 {
 
-	LocationOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	m_renderer( renderer ), m_options( renderOptions ), m_attributes( root.empty() ? SceneAlgo::globalAttributes( renderOptions.globals.get() ) : new CompoundObject ), m_renderSets( renderSets ), m_root( root )
+	LocationOutput( IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene )
+		:	m_renderer( renderer ), m_attributesCache( attributesCache ), m_options( renderOptions ), m_attributes( root.empty() ? SceneAlgo::globalAttributes( renderOptions.globals.get() ) : new CompoundObject ), m_renderSets( renderSets ), m_root( root )
 	{
 		m_transformSamples.push_back( M44f() );
 	}
@@ -1169,13 +1237,7 @@ struct LocationOutput
 
 		IECoreScenePreview::Renderer::AttributesInterfacePtr attributesInterface()
 		{
-			/// \todo Should we keep a cache of AttributesInterfaces so we can share
-			/// them between multiple objects, or should we rely on the renderers to
-			/// do something similar? Since renderers might cache some attributes
-			/// (e.g. "ai:surface") separately from others, they can do a better job,
-			/// but perhaps there might be some value in caching here at the higher
-			/// level too?
-			return m_renderer->attributes( m_attributes.get() );
+			return m_attributesCache->get( m_attributes.get() );
 		}
 
 		void applyTransform( IECoreScenePreview::Renderer::ObjectInterface *objectInterface )
@@ -1284,6 +1346,7 @@ struct LocationOutput
 		}
 
 		IECoreScenePreview::Renderer *m_renderer;
+		IECoreScenePreview::AttributesCache *m_attributesCache;
 
 		const GafferScene::Private::RendererAlgo::RenderOptions m_options;
 		IECore::ConstCompoundObjectPtr m_attributes;
@@ -1298,8 +1361,8 @@ struct LocationOutput
 struct CameraOutput : public LocationOutput
 {
 
-	CameraOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_globals( renderOptions.globals.get() ), m_cameraSet( renderSets.camerasSet() )
+	CameraOutput( IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const ScenePlug::ScenePath &root, const ScenePlug *scene )
+		:	LocationOutput( renderer, attributesCache, renderOptions, renderSets, root, scene ), m_globals( renderOptions.globals.get() ), m_cameraSet( renderSets.camerasSet() )
 	{
 	}
 
@@ -1390,8 +1453,8 @@ struct CameraOutput : public LocationOutput
 struct LightOutput : public LocationOutput
 {
 
-	LightOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_lightSet( renderSets.lightsSet() ), m_lightLinks( lightLinks )
+	LightOutput( IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
+		:	LocationOutput( renderer, attributesCache, renderOptions, renderSets, root, scene ), m_lightSet( renderSets.lightsSet() ), m_lightLinks( lightLinks )
 	{
 	}
 
@@ -1436,8 +1499,8 @@ struct LightOutput : public LocationOutput
 struct LightFiltersOutput : public LocationOutput
 {
 
-	LightFiltersOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks )
+	LightFiltersOutput( IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
+		:	LocationOutput( renderer, attributesCache, renderOptions, renderSets, root, scene ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks )
 	{
 	}
 
@@ -1482,8 +1545,8 @@ struct LightFiltersOutput : public LocationOutput
 struct ObjectOutput : public LocationOutput
 {
 
-	ObjectOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks )
+	ObjectOutput( IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
+		:	LocationOutput( renderer, attributesCache, renderOptions, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks )
 	{
 	}
 
@@ -1558,6 +1621,17 @@ struct ObjectOutput : public LocationOutput
 
 };
 
+// Returns `attributesCache` if it is non-null, and otherwise a
+// new cache for use within a single output call.
+IECoreScenePreview::AttributesCachePtr attributesCacheOrTemporary( IECoreScenePreview::AttributesCache *attributesCache, IECoreScenePreview::Renderer *renderer )
+{
+	if( attributesCache )
+	{
+		return attributesCache;
+	}
+	return new IECoreScenePreview::AttributesCache( renderer );
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -1764,7 +1838,7 @@ void outputOutputs( const ScenePlug *scene, const IECore::CompoundObject *global
 	}
 }
 
-void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer )
+void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache )
 {
 	const StringData *cameraOption = renderOptions.globals->member<StringData>( g_cameraOptionLegacyName );
 	if( cameraOption && !cameraOption->readable().empty() )
@@ -1785,37 +1859,41 @@ void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions,
 	}
 
 	const ScenePlug::ScenePath root;
-	CameraOutput output( renderer, renderOptions, renderSets, root, scene );
+	IECoreScenePreview::AttributesCachePtr cache = attributesCacheOrTemporary( attributesCache, renderer );
+	CameraOutput output( renderer, cache.get(), renderOptions, renderSets, root, scene );
 	SceneAlgo::parallelProcessLocations( scene, output );
 
 	if( !cameraOption || cameraOption->readable().empty() )
 	{
 		CameraPtr defaultCamera = new IECoreScene::Camera;
 		SceneAlgo::applyCameraGlobals( defaultCamera.get(), renderOptions.globals.get(), scene );
-		IECoreScenePreview::Renderer::AttributesInterfacePtr defaultAttributes = renderer->attributes( scene->attributesPlug()->defaultValue() );
+		IECoreScenePreview::Renderer::AttributesInterfacePtr defaultAttributes = cache->get( scene->attributesPlug()->defaultValue() );
 		ConstStringDataPtr name = new StringData( "gaffer:defaultCamera" );
 		renderer->camera( name->readable(), defaultCamera.get(), defaultAttributes.get() );
 		renderer->option( "camera", name.get() );
 	}
 }
 
-void outputLightFilters( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer )
+void outputLightFilters( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache )
 {
 	const ScenePlug::ScenePath root;
-	LightFiltersOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene );
+	IECoreScenePreview::AttributesCachePtr cache = attributesCacheOrTemporary( attributesCache, renderer );
+	LightFiltersOutput output( renderer, cache.get(), renderOptions, renderSets, lightLinks, root, scene );
 	SceneAlgo::parallelProcessLocations( scene, output );
 }
 
-void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer )
+void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, IECoreScenePreview::AttributesCache *attributesCache )
 {
 	const ScenePlug::ScenePath root;
-	LightOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene );
+	IECoreScenePreview::AttributesCachePtr cache = attributesCacheOrTemporary( attributesCache, renderer );
+	LightOutput output( renderer, cache.get(), renderOptions, renderSets, lightLinks, root, scene );
 	SceneAlgo::parallelProcessLocations( scene, output );
 }
 
-void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root )
+void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root, IECoreScenePreview::AttributesCache *attributesCache )
 {
-	ObjectOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene );
+	IECoreScenePreview::AttributesCachePtr cache = attributesCacheOrTemporary( attributesCache, renderer );
+	ObjectOutput output( renderer, cache.get(), renderOptions, renderSets, lightLinks, root, scene );
 	SceneAlgo::parallelProcessLocations( scene, output, root );
 }
 
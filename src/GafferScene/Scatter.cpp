@@ -37,6 +37,8 @@
 
 #include "GafferScene/Scatter.h"
 
+#include "GafferScene/Private/ParallelMeshAlgo.h"
+
 #include "Gaffer/StringPlug.h"
 
 #include "IECoreScene/MeshAlgo.h"
@@ -239,14 +241,29 @@ IECore::ConstObjectPtr Scatter::computeBranchObject( const ScenePath &sourcePath
 			return outPlug()->objectPlug()->defaultValue();
 		}
 
-		PointsPrimitivePtr result = MeshAlgo::distributePoints(
+		const float density = densityPlug()->getValue();
+		const std::string densityPrimitiveVariable = densityPrimitiveVariablePlug()->getValue();
+		const std::string uv = uvPlug()->getValue();
+		const std::string referencePosition = referencePositionPlug()->getValue();
+		const std::string primitiveVariables = primitiveVariablesPlug()->getValue();
+
+		// The points generated on each face depend only on that face, so we
+		// can distribute over chunks of faces in parallel and still get the
+		// same result as a serial distribution.
+		PointsPrimitivePtr result = Private::ParallelMeshAlgo::generatePoints(
 			mesh.get(),
-			densityPlug()->getValue(),
-			V2f( 0 ),
-			densityPrimitiveVariablePlug()->getValue(),
-			uvPlug()->getValue(),
-			referencePositionPlug()->getValue(),
-			primitiveVariablesPlug()->getValue(),
+			[&] ( const MeshPrimitive *mesh, const Canceller *canceller ) {
+				return MeshAlgo::distributePoints(
+					mesh,
+					density,
+					V2f( 0 ),
+					densityPrimitiveVariable,
+					uv,
+					referencePosition,
+					primitiveVariables,
+					canceller
+				);
+			},
 			context->canceller()
 		);
 		result->variables["type"] = PrimitiveVariable( PrimitiveVariable::Constant, new StringData( pointTypePlug()->getValue() ) );
@@ -292,3 +309,13 @@ IECore::ConstInternedStringVectorDataPtr Scatter::computeBranchChildNames( const
 		return outPlug()->childNamesPlug()->defaultValue();
 	}
 }
+
+Gaffer::ValuePlug::CachePolicy Scatter::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->objectPlug() )
+	{
+		// `computeBranchObject()` distributes points in parallel.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+	return BranchCreator::computeCachePolicy( output );
+}
@@ -70,6 +70,7 @@
 #include "boost/unordered_map.hpp"
 
 #include "tbb/concurrent_unordered_set.h"
+#include "tbb/concurrent_vector.h"
 #include "tbb/enumerable_thread_specific.h"
 #include "tbb/parallel_for.h"
 #include "tbb/spin_mutex.h"
@@ -260,6 +261,36 @@ IECore::PathMatcher GafferScene::SceneAlgo::findAllWithAttribute( const ScenePlu
 	);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Memory usage
+//////////////////////////////////////////////////////////////////////////
+
+SceneAlgo::ObjectMemoryUsage GafferScene::SceneAlgo::objectMemoryUsage( const ScenePlug *scene, const ScenePlug::ScenePath &root )
+{
+	tbb::concurrent_vector<ConstObjectPtr> objects;
+	auto functor = [&objects] ( const ScenePlug *scene, const ScenePlug::ScenePath &path ) {
+		ConstObjectPtr object = scene->objectPlug()->getValue();
+		if( !runTimeCast<const NullObject>( object.get() ) )
+		{
+			objects.push_back( object );
+		}
+		return true;
+	};
+	parallelProcessLocations( scene, functor, root );
+
+	ObjectMemoryUsage result;
+	Object::MemoryAccumulator accumulator;
+	for( const auto &object : objects )
+	{
+		result.numObjects++;
+		result.totalBytes += object->memoryUsage();
+		accumulator.accumulate( object.get() );
+	}
+	result.uniqueBytes = accumulator.total();
+
+	return result;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Globals
 //////////////////////////////////////////////////////////////////////////
@@ -39,17 +39,24 @@
 #include "Gaffer/Context.h"
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/TransformPlug.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
 
 #include "IECoreScene/SceneCache.h"
 #include "IECoreScene/SharedSceneInterfaces.h"
 
 #include "IECore/InternedString.h"
+#include "IECore/SimpleTypedData.h"
 #include "IECore/StringAlgo.h"
 
 #include "boost/bind/bind.hpp"
 
+#include "tbb/task_arena.h"
+
 #include "fmt/format.h"
 
+#include <atomic>
+#include <optional>
+
 using namespace std;
 using namespace boost::placeholders;
 using namespace Imath;
@@ -155,6 +162,161 @@ const ValuePlug::CachePolicy g_objectCachePolicy = cachePolicyFromEnv( "GAFFERSC
 const ValuePlug::CachePolicy g_setNamesCachePolicy = cachePolicyFromEnv( "GAFFERSCENE_SCENEREADER_SETNAMES_CACHEPOLICY" );
 const ValuePlug::CachePolicy g_setCachePolicy = cachePolicyFromEnv( "GAFFERSCENE_SCENEREADER_SET_CACHEPOLICY" );
 
+// Prefetching
+// ===========
+//
+// When `prefetchDepth` is non-zero, `computeChildNames()` enqueues a
+// background task to read the bounds, transforms and optionally objects
+// of the children, so that worker threads traversing the scene don't
+// need to wait on I/O when they reach them. The results are stored in a
+// bounded cache, from which they are removed as soon as they are used
+// for a compute. At that point the ValuePlug cache takes over
+// responsibility for them. The bound is set by `SceneReader::setPrefetchMemoryLimit()`,
+// and the cache is cleared along with the ValuePlug cache.
+
+enum class PrefetchType
+{
+	Bound,
+	Transform,
+	Object
+};
+
+IECore::MurmurHash prefetchKey( PrefetchType type, const std::string &fileName, int refreshCount, const ScenePlug::ScenePath &path, double time )
+{
+	IECore::MurmurHash h;
+	h.append( (int)type );
+	h.append( fileName );
+	h.append( refreshCount );
+	h.append( path.data(), path.size() );
+	h.append( time );
+	return h;
+}
+
+using PrefetchCache = IECorePreview::LRUCache<IECore::MurmurHash, ConstObjectPtr>;
+
+PrefetchCache &prefetchCache()
+{
+	static PrefetchCache g_cache(
+		[] ( const IECore::MurmurHash &key, size_t &cost, const IECore::Canceller *canceller ) -> ConstObjectPtr {
+			// We only ever use `set()` and `getIfCached()`.
+			throw IECore::Exception( "Prefetched value not available" );
+		},
+		// Bounded so that prefetched data that is never used can't consume
+		// unbounded memory. The least recently prefetched items are discarded
+		// first.
+		512 * 1024 * 1024
+	);
+	static Signals::Connection g_cacheClearedConnection = ValuePlug::cacheClearedSignal().connect(
+		[] { g_cache.clear(); }
+	);
+	return g_cache;
+}
+
+// Returns the prefetched value for `key`, or null if none is available.
+ConstObjectPtr takePrefetched( const IECore::MurmurHash &key )
+{
+	PrefetchCache &cache = prefetchCache();
+	if( !cache.currentCost() )
+	{
+		// Fast path for the common case of prefetching not being used.
+		return nullptr;
+	}
+
+	std::optional<ConstObjectPtr> result = cache.getIfCached( key );
+	if( !result )
+	{
+		return nullptr;
+	}
+
+	cache.erase( key );
+	return *result;
+}
+
+void prefetchLocation( const SceneInterface *scene, const std::string &fileName, int refreshCount, const ScenePlug::ScenePath &path, double time, bool objects )
+{
+	PrefetchCache &cache = prefetchCache();
+
+	if( scene->hasBound() )
+	{
+		const IECore::MurmurHash key = prefetchKey( PrefetchType::Bound, fileName, refreshCount, path, time );
+		if( !cache.cached( key ) )
+		{
+			cache.set( key, new Box3dData( scene->readBound( time ) ), sizeof( Box3d ) );
+		}
+	}
+
+	const IECore::MurmurHash transformKey = prefetchKey( PrefetchType::Transform, fileName, refreshCount, path, time );
+	if( !cache.cached( transformKey ) )
+	{
+		cache.set( transformKey, new M44dData( scene->readTransformAsMatrix( time ) ), sizeof( M44d ) );
+	}
+
+	if( objects && scene->hasObject() )
+	{
+		const IECore::MurmurHash key = prefetchKey( PrefetchType::Object, fileName, refreshCount, path, time );
+		if( !cache.cached( key ) )
+		{
+			ConstObjectPtr object = scene->readObject( time );
+			cache.set( key, object, object->memoryUsage() );
+		}
+	}
+}
+
+void prefetchWalk( const SceneInterface *scene, const std::vector<InternedString> &childNames, const std::string &fileName, int refreshCount, ScenePlug::ScenePath &path, double time, int depth, bool objects )
+{
+	path.push_back( InternedString() ); // Room for the child name
+	SceneInterface::NameList grandChildNames;
+	for( const auto &childName : childNames )
+	{
+		ConstSceneInterfacePtr child = scene->child( childName );
+		path.back() = childName;
+		prefetchLocation( child.get(), fileName, refreshCount, path, time, objects );
+		if( depth > 1 )
+		{
+			grandChildNames.clear();
+			child->childNames( grandChildNames );
+			prefetchWalk( child.get(), grandChildNames, fileName, refreshCount, path, time, depth - 1, objects );
+		}
+	}
+	path.pop_back();
+}
+
+// Prefetching is opportunistic, so rather than queue an unbounded amount of
+// work we skip it entirely when too many prefetches are already pending.
+std::atomic_int g_pendingPrefetches( 0 );
+
+void prefetch( const ConstSceneInterfacePtr &scene, const ConstInternedStringVectorDataPtr &childNames, const std::string &fileName, int refreshCount, const ScenePlug::ScenePath &path, double time, int depth, bool objects )
+{
+	if( childNames->readable().empty() )
+	{
+		return;
+	}
+
+	if( ++g_pendingPrefetches > tbb::this_task_arena::max_concurrency() )
+	{
+		--g_pendingPrefetches;
+		return;
+	}
+
+	// The task holds only the SceneInterface and plain values, so it
+	// remains valid even if the SceneReader is deleted before it runs.
+	tbb::task_arena( tbb::task_arena::attach() ).enqueue(
+		[=] {
+			ScenePlug::ScenePath walkPath = path;
+			try
+			{
+				prefetchWalk( scene.get(), childNames->readable(), fileName, refreshCount, walkPath, time, depth, objects );
+			}
+			catch( ... )
+			{
+				// Errors will be reported when the location is computed
+				// for real, so we don't need to report them here.
+			}
+			--g_pendingPrefetches;
+		}
+	);
+}
+
 } // namespace
 
 SceneReader::SceneReader( const std::string &name )
@@ -165,6 +327,8 @@ SceneReader::SceneReader( const std::string &name )
 	addChild( new IntPlug( "refreshCount" ) );
 	addChild( new StringPlug( "tags" ) );
 	addChild( new TransformPlug( "transform" ) );
+	addChild( new IntPlug( "prefetchDepth", Plug::In, 0, 0 ) );
+	addChild( new BoolPlug( "prefetchObjects" ) );
 
 	outPlug()->childBoundsPlug()->setFlags( Plug::AcceptsDependencyCycles, true );
 	plugSetSignal().connect( boost::bind( &SceneReader::plugSet, this, ::_1 ) );
@@ -214,6 +378,26 @@ const Gaffer::TransformPlug *SceneReader::transformPlug() const
 	return getChild<TransformPlug>( g_firstPlugIndex + 3 );
 }
 
+Gaffer::IntPlug *SceneReader::prefetchDepthPlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
+const Gaffer::IntPlug *SceneReader::prefetchDepthPlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 4 );
+}
+
+Gaffer::BoolPlug *SceneReader::prefetchObjectsPlug()
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 5 );
+}
+
+const Gaffer::BoolPlug *SceneReader::prefetchObjectsPlug() const
+{
+	return getChild<BoolPlug>( g_firstPlugIndex + 5 );
+}
+
 void SceneReader::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
 {
 	SceneNode::affects( input, outputs );
@@ -252,6 +436,16 @@ void SceneReader::affects( const Gaffer::Plug *input, AffectedPlugsContainer &ou
 	}
 }
 
+void SceneReader::setPrefetchMemoryLimit( size_t bytes )
+{
+	prefetchCache().setMaxCost( bytes );
+}
+
+size_t SceneReader::getPrefetchMemoryLimit()
+{
+	return prefetchCache().getMaxCost();
+}
+
 size_t SceneReader::supportedExtensions( std::vector<std::string> &extensions )
 {
 	extensions = SceneInterface::supportedExtensions();
@@ -320,7 +514,8 @@ void SceneReader::hashBound( const ScenePath &path, const Gaffer::Context *conte
 
 Imath::Box3f SceneReader::computeBound( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstSceneInterfacePtr s = scene( path, context );
+	int refreshCount = 0; string fileName;
+	ConstSceneInterfacePtr s = scene( path, context, &refreshCount, nullptr, &fileName );
 	if( !s )
 	{
 		return Box3f();
@@ -329,7 +524,9 @@ Imath::Box3f SceneReader::computeBound( const ScenePath &path, const Gaffer::Con
 	Box3f result;
 	if( s->hasBound() )
 	{
-		const Box3d b = s->readBound( timeAsDouble( context ) );
+		const double time = timeAsDouble( context );
+		ConstObjectPtr prefetched = takePrefetched( prefetchKey( PrefetchType::Bound, fileName, refreshCount, path, time ) );
+		const Box3d b = prefetched ? static_cast<const Box3dData *>( prefetched.get() )->readable() : s->readBound( time );
 		if( b.isEmpty() )
 		{
 			return Box3f();
@@ -371,13 +568,16 @@ void SceneReader::hashTransform( const ScenePath &path, const Gaffer::Context *c
 
 Imath::M44f SceneReader::computeTransform( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstSceneInterfacePtr s = scene( path, context );
+	int refreshCount = 0; string fileName;
+	ConstSceneInterfacePtr s = scene( path, context, &refreshCount, nullptr, &fileName );
 	if( !s )
 	{
 		return M44f();
 	}
 
-	const M44d t = s->readTransformAsMatrix( timeAsDouble( context ) );
+	const double time = timeAsDouble( context );
+	ConstObjectPtr prefetched = takePrefetched( prefetchKey( PrefetchType::Transform, fileName, refreshCount, path, time ) );
+	const M44d t = prefetched ? static_cast<const M44dData *>( prefetched.get() )->readable() : s->readTransformAsMatrix( time );
 	M44f result = M44f(
 		t[0][0], t[0][1], t[0][2], t[0][3],
 		t[1][0], t[1][1], t[1][2], t[1][3],
@@ -475,13 +675,20 @@ void SceneReader::hashObject( const ScenePath &path, const Gaffer::Context *cont
 
 IECore::ConstObjectPtr SceneReader::computeObject( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	ConstSceneInterfacePtr s = scene( path, context );
+	int refreshCount = 0; string fileName;
+	ConstSceneInterfacePtr s = scene( path, context, &refreshCount, nullptr, &fileName );
 	if( !s || !s->hasObject() )
 	{
 		return parent->objectPlug()->defaultValue();
 	}
 
-	return s->readObject( timeAsDouble( context ), context->canceller() );
+	const double time = timeAsDouble( context );
+	if( ConstObjectPtr prefetched = takePrefetched( prefetchKey( PrefetchType::Object, fileName, refreshCount, path, time ) ) )
+	{
+		return prefetched;
+	}
+
+	return s->readObject( time, context->canceller() );
 }
 
 void SceneReader::hashChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent, IECore::MurmurHash &h ) const
@@ -504,8 +711,8 @@ void SceneReader::hashChildNames( const ScenePath &path, const Gaffer::Context *
 
 IECore::ConstInternedStringVectorDataPtr SceneReader::computeChildNames( const ScenePath &path, const Gaffer::Context *context, const ScenePlug *parent ) const
 {
-	string tagsString;
-	ConstSceneInterfacePtr s = scene( path, context, nullptr, &tagsString );
+	int refreshCount = 0; string tagsString; string fileName;
+	ConstSceneInterfacePtr s = scene( path, context, &refreshCount, &tagsString, &fileName );
 	if( !s )
 	{
 		return parent->childNamesPlug()->defaultValue();
@@ -553,6 +760,22 @@ IECore::ConstInternedStringVectorDataPtr SceneReader::computeChildNames( const S
 		result.erase( newResultEnd, result.end() );
 	}
 
+	// Schedule prefetching of the children. Note that the prefetch plugs are
+	// deliberately not considered in `hashChildNames()`, because they don't
+	// affect the result.
+
+	int prefetchDepth; bool prefetchObjects;
+	{
+		ScenePlug::GlobalScope globalScope( context );
+		prefetchDepth = prefetchDepthPlug()->getValue();
+		prefetchObjects = prefetchObjectsPlug()->getValue();
+	}
+
+	if( prefetchDepth > 0 )
+	{
+		prefetch( s, resultData, fileName, refreshCount, path, timeAsDouble( context ), prefetchDepth, prefetchObjects );
+	}
+
 	return resultData;
 }
 
@@ -705,10 +928,11 @@ void SceneReader::plugSet( Gaffer::Plug *plug )
 	{
 		SharedSceneInterfaces::clear();
 		m_lastScene.clear();
+		prefetchCache().clear();
 	}
 }
 
-ConstSceneInterfacePtr SceneReader::scene( const ScenePath &path, const Gaffer::Context *context, int *refreshCount, std::string *tags ) const
+ConstSceneInterfacePtr SceneReader::scene( const ScenePath &path, const Gaffer::Context *context, int *refreshCount, std::string *tags, std::string *fileNameResult ) const
 {
 	ScenePlug::GlobalScope globalScope( context );
 
@@ -726,6 +950,10 @@ ConstSceneInterfacePtr SceneReader::scene( const ScenePath &path, const Gaffer::
 	{
 		*tags = tagsPlug()->getValue();
 	}
+	if( fileNameResult )
+	{
+		*fileNameResult = fileName;
+	}
 
 	LastScene &lastScene = m_lastScene.local();
 	if( lastScene.fileName == fileName )
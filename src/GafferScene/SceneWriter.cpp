@@ -44,9 +44,14 @@
 
 #include "IECoreScene/SceneInterface.h"
 
-#include "tbb/mutex.h"
+#include "boost/noncopyable.hpp"
 
+#include "tbb/concurrent_queue.h"
+
+#include <atomic>
 #include <filesystem>
+#include <thread>
+#include <unordered_map>
 
 using namespace std;
 using namespace IECore;
@@ -57,116 +62,281 @@ using namespace GafferScene;
 namespace
 {
 
-struct LocationWriter
+// Writing is performed as a pipeline. Worker threads compute the data for
+// each location in parallel via `SceneAlgo::parallelProcessLocations()` and
+// push it onto a queue, from which a single dedicated thread writes it to the
+// SceneInterface. This allows scene generation to overlap with writing, and
+// means that workers never need to wait on a lock for the SceneInterface.
+//
+// Because `parallelProcessLocations()` only visits a location after its parent
+// has been processed, the parent's data is always queued before its children's.
+// The writer thread therefore always sees a parent before its children, and can
+// create the SceneInterface children in the correct order.
+
+struct LocationData
 {
-	LocationWriter(SceneInterfacePtr output, ConstCompoundDataPtr sets, float time, tbb::mutex& mutex) : m_output( output ), m_sets(sets), m_time( time ), m_mutex( mutex )
-	{
-	}
+	// Unique identifiers for the location and its parent, assigned by
+	// the producer. A `parentId` of 0 denotes the root.
+	uint64_t id;
+	uint64_t parentId;
+	InternedString name;
+
+	ConstCompoundObjectPtr attributes;
+	ConstCompoundObjectPtr globals;
+	ConstObjectPtr object;
+	Imath::Box3f bound;
+	IECore::M44dDataPtr transform;
+	SceneInterface::NameList sets;
+	ConstInternedStringVectorDataPtr childNames;
+};
 
-	~LocationWriter()
-	{
-		// Some implementations of SceneInterface may perform writing when we release the SceneInterface,
-		// so we need to hold the lock while freeing it
-		tbb::mutex::scoped_lock scopedLock( m_mutex );
-		m_output.reset();
-	}
+class LocationPipeline : boost::noncopyable
+{
 
-	/// first half of this function can be lock free reading data from ScenePlug
-	/// once all the data has been read then we take a global lock and write
-	/// into the SceneInterface
-	bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &scenePath )
-	{
-		ConstCompoundObjectPtr attributes = scene->attributesPlug()->getValue();
+	public :
 
-		ConstCompoundObjectPtr globals;
+		LocationPipeline( const SceneInterfacePtr &root, float time )
+			:	m_root( root ), m_time( time ), m_nextId( 1 ), m_failed( false )
+		{
+			// Bound the queue so that memory usage remains under control if
+			// the workers generate data faster than it can be written.
+			m_queue.set_capacity( 1024 );
+			m_writerThread = std::thread( [this] { writerLoop(); } );
+		}
 
-		ConstObjectPtr object = scene->objectPlug()->getValue();
-		Imath::Box3f bound = scene->boundPlug()->getValue();
+		~LocationPipeline()
+		{
+			if( m_writerThread.joinable() )
+			{
+				m_queue.push( nullptr );
+				m_writerThread.join();
+			}
+		}
 
-		IECore::M44dDataPtr transformData;
+		uint64_t nextId()
+		{
+			return m_nextId++;
+		}
 
-		if( scenePath.empty() )
+		bool failed() const
 		{
-			globals = scene->globals();
+			return m_failed;
 		}
-		else
+
+		// Takes ownership of `data`.
+		void push( std::unique_ptr<LocationData> data )
 		{
-			Imath::M44f t = scene->transformPlug()->getValue();
-			transformData = new IECore::M44dData( Imath::M44d (
-				t[0][0], t[0][1], t[0][2], t[0][3],
-				t[1][0], t[1][1], t[1][2], t[1][3],
-				t[2][0], t[2][1], t[2][2], t[2][3],
-				t[3][0], t[3][1], t[3][2], t[3][3]
-			) );
+			m_queue.push( data.release() );
 		}
 
-		SceneInterface::NameList locationSets;
-		if( m_sets )
+		// Waits for all queued locations to be written, rethrowing any
+		// exception encountered while writing.
+		void finish()
 		{
-			const CompoundDataMap &setsMap = m_sets->readable();
-			locationSets.reserve( setsMap.size() );
+			m_queue.push( nullptr );
+			m_writerThread.join();
+			if( m_exception )
+			{
+				std::rethrow_exception( m_exception );
+			}
+		}
+
+	private :
 
-			for( const auto &[name, data] : setsMap )
+		void writerLoop()
+		{
+			while( true )
 			{
-				auto pathMatcher = static_cast<const PathMatcherData *>( data.get() );
-				if( pathMatcher->readable().match( scenePath ) & IECore::PathMatcher::ExactMatch )
+				LocationData *rawData;
+				m_queue.pop( rawData );
+				if( !rawData )
 				{
-					locationSets.push_back( name );
+					break;
+				}
+
+				std::unique_ptr<LocationData> data( rawData );
+				if( m_exception )
+				{
+					// Keep draining the queue so that producers can't
+					// block on a full queue.
+					continue;
+				}
+
+				try
+				{
+					write( *data );
+				}
+				catch( ... )
+				{
+					m_exception = std::current_exception();
+					m_failed = true;
 				}
 			}
+
+			// Some implementations of SceneInterface may perform writing when
+			// we release the SceneInterface, so make sure that happens on this
+			// thread.
+			m_openLocations.clear();
 		}
 
-		ConstInternedStringVectorDataPtr childNames = scene->childNamesPlug()->getValue();
+		void write( const LocationData &data )
+		{
+			SceneInterfacePtr output = data.parentId ? m_openLocations.at( data.parentId ).output->child( data.name ) : m_root;
 
-		tbb::mutex::scoped_lock scopedLock( m_mutex );
+			if( data.object->typeId() != IECore::NullObjectTypeId && data.parentId )
+			{
+				output->writeObject( data.object.get(), m_time );
+			}
 
-		if( !scenePath.empty() )
-		{
-			m_output = m_output->child( scenePath.back() );
+			output->writeBound( Imath::Box3d( Imath::V3f( data.bound.min ), Imath::V3f( data.bound.max ) ), m_time );
+
+			if( data.transform )
+			{
+				output->writeTransform( data.transform.get(), m_time );
+			}
+
+			for( const auto &[name, value] : data.attributes->members() )
+			{
+				output->writeAttribute( name, value.get(), m_time );
+			}
+
+			if( data.globals && !data.globals->members().empty() )
+			{
+				output->writeAttribute( "gaffer:globals", data.globals.get(), m_time );
+			}
+
+			if( !data.sets.empty() )
+			{
+				output->writeTags( data.sets );
+			}
+
+			const vector<InternedString> &childNames = data.childNames->readable();
+			for( const auto &childName : childNames )
+			{
+				// `SceneAlgo::parallelProcessLocations()` may visit children in any
+				// order. Pre-create SceneInterface children here so that they are
+				// created in the correct order.
+				output->child( childName, SceneInterface::CreateIfMissing );
+			}
+
+			if( childNames.size() )
+			{
+				// Keep the location open until all its children have been written.
+				m_openLocations[data.id] = { output, childNames.size(), data.parentId };
+			}
+			else
+			{
+				output.reset();
+				childWritten( data.parentId );
+			}
 		}
 
-		if( object->typeId() != IECore::NullObjectTypeId && scenePath.size() > 0 )
+		// Releases ancestors which have had all their children written.
+		void childWritten( uint64_t parentId )
 		{
-			m_output->writeObject( object.get(), m_time );
+			while( parentId )
+			{
+				auto it = m_openLocations.find( parentId );
+				if( --it->second.remainingChildren )
+				{
+					return;
+				}
+				parentId = it->second.parentId;
+				m_openLocations.erase( it );
+			}
 		}
 
-		m_output->writeBound( Imath::Box3d( Imath::V3f( bound.min ), Imath::V3f( bound.max ) ), m_time );
+		const SceneInterfacePtr m_root;
+		const float m_time;
+
+		std::atomic_uint64_t m_nextId;
+		tbb::concurrent_bounded_queue<LocationData *> m_queue;
+		std::thread m_writerThread;
 
-		if( transformData )
+		// Only accessed by the writer thread until it has been joined.
+		struct OpenLocation
 		{
-			m_output->writeTransform( transformData.get(), m_time );
-		}
+			SceneInterfacePtr output;
+			size_t remainingChildren;
+			uint64_t parentId;
+		};
+		std::unordered_map<uint64_t, OpenLocation> m_openLocations;
+		std::exception_ptr m_exception;
+		std::atomic_bool m_failed;
+
+};
 
-		for( CompoundObject::ObjectMap::const_iterator it = attributes->members().begin(), eIt = attributes->members().end(); it != eIt; it++ )
+struct LocationProducer
+{
+	LocationProducer( LocationPipeline &pipeline, ConstCompoundDataPtr sets ) : m_pipeline( &pipeline ), m_sets( sets ), m_id( 0 )
+	{
+	}
+
+	/// Reads all the data for the location from the ScenePlug, and then hands
+	/// it off to the pipeline for writing.
+	bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &scenePath )
+	{
+		if( m_pipeline->failed() )
 		{
-			m_output->writeAttribute( it->first, it->second.get(), m_time );
+			// No point computing anything more. The error will be
+			// rethrown by `LocationPipeline::finish()`.
+			return false;
 		}
 
-		if( globals && !globals->members().empty() )
+		auto data = std::make_unique<LocationData>();
+		data->parentId = m_id;
+		data->id = m_id = m_pipeline->nextId();
+		if( !scenePath.empty() )
 		{
-			m_output->writeAttribute( "gaffer:globals", globals.get(), m_time );
+			data->name = scenePath.back();
 		}
 
-		if( !locationSets.empty() )
+		data->attributes = scene->attributesPlug()->getValue();
+		data->object = scene->objectPlug()->getValue();
+		data->bound = scene->boundPlug()->getValue();
+
+		if( scenePath.empty() )
 		{
-			m_output->writeTags( locationSets );
+			data->globals = scene->globals();
+		}
+		else
+		{
+			Imath::M44f t = scene->transformPlug()->getValue();
+			data->transform = new IECore::M44dData( Imath::M44d (
+				t[0][0], t[0][1], t[0][2], t[0][3],
+				t[1][0], t[1][1], t[1][2], t[1][3],
+				t[2][0], t[2][1], t[2][2], t[2][3],
+				t[3][0], t[3][1], t[3][2], t[3][3]
+			) );
 		}
 
-		for( const auto &childName : childNames->readable() )
+		if( m_sets )
 		{
-			// `SceneAlgo::parallelProcessLocations()` may visit children in any
-			// order. Pre-create SceneInterface children here so that they are
-			// created in the correct order.
-			m_output->child( childName, SceneInterface::CreateIfMissing );
+			const CompoundDataMap &setsMap = m_sets->readable();
+			data->sets.reserve( setsMap.size() );
+
+			for( const auto &[name, setData] : setsMap )
+			{
+				auto pathMatcher = static_cast<const PathMatcherData *>( setData.get() );
+				if( pathMatcher->readable().match( scenePath ) & IECore::PathMatcher::ExactMatch )
+				{
+					data->sets.push_back( name );
+				}
+			}
 		}
 
+		data->childNames = scene->childNamesPlug()->getValue();
+
+		m_pipeline->push( std::move( data ) );
 		return true;
 	}
 
-	SceneInterfacePtr m_output;
+	LocationPipeline *m_pipeline;
 	ConstCompoundDataPtr m_sets;
-	float m_time;
-	tbb::mutex &m_mutex;
+	// Identifier for the location most recently processed by this
+	// functor. Copies of the functor are used for the children, so
+	// this becomes their `parentId`.
+	uint64_t m_id;
 };
 
 }
@@ -251,7 +421,6 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 	}
 
 	SceneInterfacePtr output;
-	tbb::mutex mutex;
 	ContextPtr context = new Context( *Context::current() );
 	Context::Scope scopedContext( context.get() );
 
@@ -270,8 +439,12 @@ void SceneWriter::executeSequence( const std::vector<float> &frames ) const
 			useSetsAPI = SceneReader::useSetsAPI( output.get() );
 		}
 
-		LocationWriter locationWriter( output, !useSetsAPI ? sets : nullptr, context->getTime(), mutex );
-		SceneAlgo::parallelProcessLocations( scene, locationWriter );
+		{
+			LocationPipeline pipeline( output, context->getTime() );
+			LocationProducer locationProducer( pipeline, !useSetsAPI ? sets : nullptr );
+			SceneAlgo::parallelProcessLocations( scene, locationProducer );
+			pipeline.finish();
+		}
 
 		if( useSetsAPI && sets )
 		{
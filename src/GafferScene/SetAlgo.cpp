@@ -40,6 +40,8 @@
 
 #include "GafferScene/SetAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
@@ -53,6 +55,12 @@
 
 #include "fmt/format.h"
 
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_invoke.h"
+
+#include <memory>
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferScene;
@@ -191,6 +199,65 @@ std::ostream& operator<<( std::ostream& stream, const ExpressionAst& expr )
 
 // Evaluating the AST
 // ------------------
+
+// Appends the operands of a chain of `op` operations to `operands`. The parser
+// produces chains such as `A | B | C` as nested BinaryOps, but for associative
+// operations we can evaluate all the operands concurrently and then combine
+// them in a balanced tree.
+void collectOperands( const ExpressionAst &ast, Op op, std::vector<const ExpressionAst *> &operands )
+{
+	if( const BinaryOp *binaryOp = boost::get<BinaryOp>( &ast.expr ) )
+	{
+		if( binaryOp->op == op )
+		{
+			collectOperands( binaryOp->left, op, operands );
+			collectOperands( binaryOp->right, op, operands );
+			return;
+		}
+	}
+	else if( const ExpressionAst *child = boost::get<ExpressionAst>( &ast.expr ) )
+	{
+		collectOperands( *child, op, operands );
+		return;
+	}
+
+	operands.push_back( &ast );
+}
+
+// Combines `matchers[begin:end]` using `op`, which must be either `Or` or `And`.
+// Halves are combined concurrently, and the input matchers are consumed.
+PathMatcher combine( std::vector<PathMatcher> &matchers, size_t begin, size_t end, Op op, tbb::task_group_context &taskGroupContext )
+{
+	const size_t size = end - begin;
+	if( size == 1 )
+	{
+		return std::move( matchers[begin] );
+	}
+
+	PathMatcher left, right;
+	if( size == 2 )
+	{
+		left = std::move( matchers[begin] );
+		right = std::move( matchers[begin+1] );
+	}
+	else
+	{
+		const size_t mid = begin + size / 2;
+		tbb::parallel_invoke(
+			[&] { left = combine( matchers, begin, mid, op, taskGroupContext ); },
+			[&] { right = combine( matchers, mid, end, op, taskGroupContext ); },
+			taskGroupContext
+		);
+	}
+
+	if( op == Or )
+	{
+		left.addPaths( right );
+		return left;
+	}
+	return left.intersection( right );
+}
+
 struct AstEvaluator
 {
 	using result_type = PathMatcher;
@@ -222,28 +289,40 @@ struct AstEvaluator
 				return m_scene->set( identifier )->readable();
 			}
 
-			result_type result;
-
 			IECore::ConstInternedStringVectorDataPtr setNamesData = m_scene->setNamesPlug()->getValue();
-			const std::vector<IECore::InternedString> &setNames = setNamesData->readable();
-			if( setNames.empty() )
+			std::vector<const IECore::InternedString *> matchingSetNames;
+			for( const IECore::InternedString &setName : setNamesData->readable() )
 			{
-				return result;
-			}
-
-			ScenePlug::SetScope setScope( Context::current() );
-			for( const IECore::InternedString &setName : setNames )
-			{
-				if( !StringAlgo::match( setName.string(), identifier ) )
+				if( StringAlgo::match( setName.string(), identifier ) )
 				{
-					continue;
+					matchingSetNames.push_back( &setName );
 				}
+			}
 
-				setScope.setSetName( &setName );
-				ConstPathMatcherDataPtr setData = m_scene->setPlug()->getValue();
-				result.addPaths( setData->readable() );
+			if( matchingSetNames.empty() )
+			{
+				return PathMatcher();
 			}
-			return result;
+
+			// Fetch all the sets in parallel, and then union them.
+
+			std::vector<PathMatcher> sets( matchingSetNames.size() );
+			const ThreadState &threadState = ThreadState::current();
+			tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, matchingSetNames.size(), 1 ),
+				[&] ( const tbb::blocked_range<size_t> &r ) {
+					ScenePlug::SetScope setScope( threadState );
+					for( size_t i = r.begin(); i != r.end(); ++i )
+					{
+						setScope.setSetName( matchingSetNames[i] );
+						sets[i] = m_scene->setPlug()->getValue()->readable();
+					}
+				},
+				taskGroupContext
+			);
+
+			return combine( sets, 0, sets.size(), Or, taskGroupContext );
 		}
 	}
 
@@ -260,21 +339,46 @@ struct AstEvaluator
 
 	result_type operator()( const BinaryOp &expr ) const
 	{
-		PathMatcher left = boost::apply_visitor( *this, expr.left.expr );
-		PathMatcher right = boost::apply_visitor( *this, expr.right.expr );
+		const ThreadState &threadState = ThreadState::current();
+		tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+		if( expr.op == Or || expr.op == And )
+		{
+			std::vector<const ExpressionAst *> operands;
+			collectOperands( expr.left, expr.op, operands );
+			collectOperands( expr.right, expr.op, operands );
+
+			std::vector<PathMatcher> results( operands.size() );
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, operands.size(), 1 ),
+				[&] ( const tbb::blocked_range<size_t> &r ) {
+					ThreadState::Scope threadStateScope( threadState );
+					for( size_t i = r.begin(); i != r.end(); ++i )
+					{
+						results[i] = (*this)( *operands[i] );
+					}
+				},
+				taskGroupContext
+			);
+
+			return combine( results, 0, results.size(), expr.op, taskGroupContext );
+		}
+
+		PathMatcher left, right;
+		tbb::parallel_invoke(
+			[&] {
+				ThreadState::Scope threadStateScope( threadState );
+				left = boost::apply_visitor( *this, expr.left.expr );
+			},
+			[&] {
+				ThreadState::Scope threadStateScope( threadState );
+				right = boost::apply_visitor( *this, expr.right.expr );
+			},
+			taskGroupContext
+		);
 
 		switch( expr.op )
 		{
-			case Or :
-			{
-				PathMatcher result = PathMatcher( left );
-				result.addPaths( right );
-				return result;
-			}
-			case And :
-			{
-				return left.intersection( right );
-			}
 			case AndNot :
 			{
 				PathMatcher result = PathMatcher( left );
@@ -511,6 +615,26 @@ void expressionToAST( const std::string &setExpression, ExpressionAst &ast)
 	}
 }
 
+// Parsing is relatively expensive, and the same expressions are typically
+// evaluated many times in many different contexts, so we cache the parsed
+// ASTs. Syntax errors are cached too, and rethrown on subsequent requests.
+using ConstExpressionAstPtr = std::shared_ptr<const ExpressionAst>;
+using AstCache = IECorePreview::LRUCache<std::string, ConstExpressionAstPtr, IECorePreview::LRUCachePolicy::Parallel>;
+
+AstCache &astCache()
+{
+	static AstCache *g_cache = new AstCache(
+		[] ( const std::string &setExpression, size_t &cost, const IECore::Canceller *canceller ) {
+			auto ast = std::make_shared<ExpressionAst>();
+			expressionToAST( setExpression, *ast );
+			cost = 1;
+			return ast;
+		},
+		10000
+	);
+	return *g_cache;
+}
+
 } // namespace
 
 namespace GafferScene
@@ -521,20 +645,18 @@ namespace SetAlgo
 
 PathMatcher evaluateSetExpression( const std::string &setExpression, const ScenePlug *scene )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstExpressionAstPtr ast = astCache().get( setExpression );
 
 	AstEvaluator eval( scene );
-	return eval( ast );
+	return eval( *ast );
 }
 
 void setExpressionHash( const std::string &setExpression, const ScenePlug* scene, IECore::MurmurHash &h )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
+	ConstExpressionAstPtr ast = astCache().get( setExpression );
 
 	AstHasher hasher = AstHasher( scene, h );
-	hasher(ast);
+	hasher( *ast );
 }
 
 IECore::MurmurHash setExpressionHash( const std::string &setExpression, const ScenePlug* scene)
@@ -36,6 +36,7 @@
 
 #include "GafferScene/ShufflePrimitiveVariables.h"
 
+#include "GafferScene/Private/PrimitiveAlgo.h"
 #include "GafferScene/SceneAlgo.h"
 
 #include "IECoreScene/Primitive.h"
@@ -95,7 +96,7 @@ IECore::ConstObjectPtr ShufflePrimitiveVariables::computeProcessedObject( const
 		return inputObject;
 	}
 
-	PrimitivePtr result = inputPrimitive->copy();
+	PrimitivePtr result = Private::PrimitiveAlgo::copyWithSharedVariables( inputPrimitive );
 	result->variables = shufflesPlug()->shuffle<PrimitiveVariableMap>( inputPrimitive->variables );
 
 	return result;
@@ -100,3 +100,22 @@ PrimitiveSampler::SamplingFunction UVSampler::computeSamplingFunction( const IEC
 		return evaluator.pointAtUV( uvView[index], &result );
 	};
 }
+
+void UVSampler::computeSamplingOrder( const IECoreScene::Primitive *destinationPrimitive, IECoreScene::PrimitiveVariable::Interpolation interpolation, std::vector<size_t> &order ) const
+{
+	auto it = destinationPrimitive->variables.find( uvPlug()->getValue() );
+	if( it == destinationPrimitive->variables.end() )
+	{
+		return;
+	}
+
+	// Queries at nearby UVs are likely to hit the same faces of the
+	// source primitive, so we order them in UV space.
+	PrimitiveVariable::IndexedView<V2f> uvView( it->second );
+	std::vector<V3f> positions( uvView.size() );
+	for( size_t i = 0; i < positions.size(); ++i )
+	{
+		positions[i] = V3f( uvView[i].x, uvView[i].y, 0.0f );
+	}
+	spatialOrder( positions, order );
+}
@@ -70,6 +70,10 @@ void GafferSceneModule::bindIO()
 {
 
 	GafferBindings::DependencyNodeClass<SceneReader>()
+		.def( "setPrefetchMemoryLimit", &SceneReader::setPrefetchMemoryLimit )
+		.staticmethod( "setPrefetchMemoryLimit" )
+		.def( "getPrefetchMemoryLimit", &SceneReader::getPrefetchMemoryLimit )
+		.staticmethod( "getPrefetchMemoryLimit" )
 		.def( "supportedExtensions", &supportedExtensions )
 		.staticmethod( "supportedExtensions" )
 	;
@@ -40,6 +40,7 @@
 
 #include "GafferScene/InteractiveRender.h"
 #include "GafferScene/OpenGLRender.h"
+#include "GafferScene/Private/IECoreScenePreview/AttributesCache.h"
 #include "GafferScene/Private/IECoreScenePreview/CapturingRenderer.h"
 #include "GafferScene/Private/IECoreScenePreview/CompoundRenderer.h"
 #include "GafferScene/Private/IECoreScenePreview/Geometry.h"
@@ -150,6 +151,25 @@ IECoreScenePreview::Renderer::ObjectInterfacePtr rendererObject2( Renderer &rend
 	return renderer.object( name, samples, times, attributes );
 }
 
+void rendererInstances( Renderer &renderer, object pythonNames, object pythonSamples, object pythonTimes, object pythonTransforms, object pythonTransformTimes, const Renderer::AttributesInterface *attributes )
+{
+	std::vector<std::string> names;
+	container_utils::extend_container( names, pythonNames );
+
+	std::vector<const IECore::Object *> samples;
+	container_utils::extend_container( samples, pythonSamples );
+
+	std::vector<float> times;
+	container_utils::extend_container( times, pythonTimes );
+
+	std::vector<Imath::M44f> transforms;
+	container_utils::extend_container( transforms, pythonTransforms );
+
+	std::vector<float> transformTimes;
+	container_utils::extend_container( transformTimes, pythonTransformTimes );
+
+	renderer.instances( names, samples, times, transforms, transformTimes, attributes );
+}
 
 IECoreScenePreview::Renderer::ObjectInterfacePtr rendererCamera1( Renderer &renderer, const std::string &name, const IECoreScene::Camera *camera, const Renderer::AttributesInterface *attributes )
 {
@@ -415,22 +435,22 @@ object transformSamplesWrapper( const Gaffer::M44fPlug &transformPlug, const std
 	return pythonSamples;
 }
 
-void outputCamerasWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, IECoreScenePreview::Renderer &renderer )
+void outputCamerasWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, IECoreScenePreview::Renderer &renderer, IECoreScenePreview::AttributesCache *attributesCache )
 {
 	IECorePython::ScopedGILRelease gilRelease;
-	GafferScene::Private::RendererAlgo::outputCameras( &scene, renderOptions, renderSets, &renderer );
+	GafferScene::Private::RendererAlgo::outputCameras( &scene, renderOptions, renderSets, &renderer, attributesCache );
 }
 
-void outputLightsWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks &lightLinks, IECoreScenePreview::Renderer &renderer )
+void outputLightsWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks &lightLinks, IECoreScenePreview::Renderer &renderer, IECoreScenePreview::AttributesCache *attributesCache )
 {
 	IECorePython::ScopedGILRelease gilRelease;
-	GafferScene::Private::RendererAlgo::outputLights( &scene, renderOptions, renderSets, &lightLinks, &renderer );
+	GafferScene::Private::RendererAlgo::outputLights( &scene, renderOptions, renderSets, &lightLinks, &renderer, attributesCache );
 }
 
-void outputObjectsWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks &lightLinks, IECoreScenePreview::Renderer &renderer, const ScenePlug::ScenePath &root )
+void outputObjectsWrapper( const ScenePlug &scene, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, GafferScene::Private::RendererAlgo::LightLinks &lightLinks, IECoreScenePreview::Renderer &renderer, const ScenePlug::ScenePath &root, IECoreScenePreview::AttributesCache *attributesCache )
 {
 	IECorePython::ScopedGILRelease gilRelease;
-	GafferScene::Private::RendererAlgo::outputObjects( &scene, renderOptions, renderSets, &lightLinks, &renderer, root );
+	GafferScene::Private::RendererAlgo::outputObjects( &scene, renderOptions, renderSets, &lightLinks, &renderer, root, attributesCache );
 }
 
 } // namespace
@@ -490,9 +510,9 @@ void GafferSceneModule::bindRender()
 				.def( init<>() )
 			;
 
-			def( "outputCameras", &outputCamerasWrapper );
-			def( "outputLights", &outputLightsWrapper );
-			def( "outputObjects", &outputObjectsWrapper, ( arg( "scene" ), arg( "globals" ), arg( "renderSets" ), arg( "lightLinks" ), arg( "renderer" ), arg( "root" ) = "/" ) );
+			def( "outputCameras", &outputCamerasWrapper, ( arg( "scene" ), arg( "globals" ), arg( "renderSets" ), arg( "renderer" ), arg( "attributesCache" ) = object() ) );
+			def( "outputLights", &outputLightsWrapper, ( arg( "scene" ), arg( "globals" ), arg( "renderSets" ), arg( "lightLinks" ), arg( "renderer" ), arg( "attributesCache" ) = object() ) );
+			def( "outputObjects", &outputObjectsWrapper, ( arg( "scene" ), arg( "globals" ), arg( "renderSets" ), arg( "lightLinks" ), arg( "renderer" ), arg( "root" ) = "/", arg( "attributesCache" ) = object() ) );
 		}
 
 		object ieCoreScenePreviewModule( borrowed( PyImport_AddModule( "GafferScene.Private.IECoreScenePreview" ) ) );
@@ -543,6 +563,7 @@ void GafferSceneModule::bindRender()
 
 			.def( "object", &rendererObject1 )
 			.def( "object", &rendererObject2 )
+			.def( "instances", &rendererInstances )
 
 			.def( "render", render )
 			.def( "pause", &Renderer::pause )
@@ -556,6 +577,22 @@ void GafferSceneModule::bindRender()
 			.def( "__init__", make_constructor( compoundRendererConstructor, default_call_policies(), arg( "renderers" ) ) )
 		;
 
+		{
+			scope attributesCacheScope = IECorePython::RefCountedClass<AttributesCache, IECore::RefCounted>( "AttributesCache" )
+				.def( init<Renderer *>( arg( "renderer" ) )[ with_custodian_and_ward<1, 2>() ] )
+				.def( "get", &AttributesCache::get )
+				.def( "clearUnused", &AttributesCache::clearUnused )
+				.def( "statistics", &AttributesCache::statistics )
+			;
+
+			class_<AttributesCache::Statistics>( "Statistics" )
+				.def_readonly( "attributesHits", &AttributesCache::Statistics::attributesHits )
+				.def_readonly( "attributesMisses", &AttributesCache::Statistics::attributesMisses )
+				.def_readonly( "shaderHits", &AttributesCache::Statistics::shaderHits )
+				.def_readonly( "shaderMisses", &AttributesCache::Statistics::shaderMisses )
+			;
+		}
+
 		IECorePython::RunTimeTypedClass<IECoreScenePreview::Procedural, ProceduralWrapper>()
 			.def( init<>() )
 			.def( "render", (void (Procedural::*)( IECoreScenePreview::Renderer *)const)&Procedural::render )
@@ -601,16 +638,31 @@ void GafferSceneModule::bindRender()
 			.def( init<Renderer::RenderType, const std::string &, const IECore::MessageHandlerPtr &>( ( arg( "renderType" ) = Renderer::RenderType::Interactive, arg( "fileName" ) = "", arg( "messageHandler") = IECore::MessageHandlerPtr() ) ) )
 			.def( "capturedObjectNames", &capturingRendererCapturedObjectNames )
 			.def( "capturedObject", &capturingRendererCapturedObject )
+			.def( "numInstanceBatches", &CapturingRenderer::numInstanceBatches )
+			.def( "statistics", &CapturingRenderer::statistics )
+		;
+
+		class_<CapturingRenderer::Statistics>( "Statistics" )
+			.def_readonly( "attributes", &CapturingRenderer::Statistics::attributes )
+			.def_readonly( "cameras", &CapturingRenderer::Statistics::cameras )
+			.def_readonly( "lights", &CapturingRenderer::Statistics::lights )
+			.def_readonly( "lightFilters", &CapturingRenderer::Statistics::lightFilters )
+			.def_readonly( "objects", &CapturingRenderer::Statistics::objects )
+			.def_readonly( "transformEdits", &CapturingRenderer::Statistics::transformEdits )
+			.def_readonly( "attributeEdits", &CapturingRenderer::Statistics::attributeEdits )
+			.def_readonly( "linkEdits", &CapturingRenderer::Statistics::linkEdits )
 		;
 
 		IECorePython::RefCountedClass<CapturingRenderer::CapturedAttributes, Renderer::AttributesInterface>( "CapturedAttributes" )
 			.def( "attributes", &capturedAttributesAttributes )
+			.def( "hash", &CapturingRenderer::CapturedAttributes::hash )
 		;
 
 		IECorePython::RefCountedClass<CapturingRenderer::CapturedObject, Renderer::ObjectInterface>( "CapturedObject" )
 			.def( "capturedName", &capturedObjectCapturedName )
 			.def( "capturedSamples", &capturedObjectCapturedSamples )
 			.def( "capturedSampleTimes", &capturedObjectCapturedSampleTimes )
+			.def( "capturedSamplesHash", &CapturingRenderer::CapturedObject::capturedSamplesHash )
 			.def( "capturedTransforms", &capturedObjectCapturedTransforms )
 			.def( "capturedTransformTimes", &capturedObjectCapturedTransformTimes )
 			.def( "capturedAttributes", &capturedObjectCapturedAttributes )
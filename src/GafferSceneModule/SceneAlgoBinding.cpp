@@ -148,6 +148,12 @@ IECore::PathMatcher findAllWithAttributeWrapper( const ScenePlug &scene, Interne
 	return SceneAlgo::findAllWithAttribute( &scene, name, value, root );
 }
 
+SceneAlgo::ObjectMemoryUsage objectMemoryUsageWrapper( const ScenePlug &scene, const ScenePlug::ScenePath &root )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return SceneAlgo::objectMemoryUsage( &scene, root );
+}
+
 Imath::V2f shutterWrapper( const IECore::CompoundObject &globals, const ScenePlug &scene )
 {
 	IECorePython::ScopedGILRelease r;
@@ -377,6 +383,13 @@ void bindSceneAlgo()
 	def( "findAll", &findAllWrapper, ( arg( "scene" ), arg( "predicate" ), arg( "root" ) = "/" ) );
 	def( "findAllWithAttribute", &findAllWithAttributeWrapper, ( arg( "scene" ), arg( "name" ), arg( "value" ) = object(), arg( "root" ) = "/" ) );
 
+	class_<SceneAlgo::ObjectMemoryUsage>( "ObjectMemoryUsage" )
+		.def_readonly( "numObjects", &SceneAlgo::ObjectMemoryUsage::numObjects )
+		.def_readonly( "totalBytes", &SceneAlgo::ObjectMemoryUsage::totalBytes )
+		.def_readonly( "uniqueBytes", &SceneAlgo::ObjectMemoryUsage::uniqueBytes )
+	;
+	def( "objectMemoryUsage", &objectMemoryUsageWrapper, ( arg( "scene" ), arg( "root" ) = "/" ) );
+
 	def( "shutter", &shutterWrapper );
 	def( "setExists", &setExistsWrapper );
 	def(
@@ -42,6 +42,8 @@
 
 #include "boost/bind/bind.hpp"
 
+#include "tbb/spin_mutex.h"
+
 using namespace std;
 using namespace boost::placeholders;
 using namespace IECore;
@@ -64,6 +66,20 @@ struct SceneEvaluateFunctor
 	}
 };
 
+template<typename Volume>
+IECore::PathMatcher culledTraverseSceneInternal( const GafferScene::ScenePlug *scenePlug, const Volume &volume, const Imath::M44f &worldToVolume )
+{
+	IECore::PathMatcher result;
+	tbb::spin_mutex mutex;
+	auto f = [&] ( const GafferScene::ScenePlug *scene, const GafferScene::ScenePlug::ScenePath &path ) {
+		tbb::spin_mutex::scoped_lock lock( mutex );
+		result.addPath( path );
+		return true;
+	};
+	SceneAlgo::culledParallelTraverse( scenePlug, volume, worldToVolume, f );
+	return result;
+}
+
 void traverseOnDirty( const Gaffer::Plug *dirtiedPlug, ConstScenePlugPtr scene )
 {
 	if( dirtiedPlug == scene.get() )
@@ -92,6 +108,21 @@ void GafferSceneTest::traverseScene( const GafferScene::ScenePlug *scenePlug )
 	SceneAlgo::parallelTraverse( scenePlug, f );
 }
 
+IECore::PathMatcher GafferSceneTest::culledTraverseScene( const GafferScene::ScenePlug *scenePlug, const Imath::Box3f &box, const Imath::M44f &worldToBox )
+{
+	return culledTraverseSceneInternal( scenePlug, box, worldToBox );
+}
+
+IECore::PathMatcher GafferSceneTest::culledTraverseScene( const GafferScene::ScenePlug *scenePlug, const Imath::Line3f &ray, const Imath::M44f &worldToRay )
+{
+	return culledTraverseSceneInternal( scenePlug, ray, worldToRay );
+}
+
+IECore::PathMatcher GafferSceneTest::culledTraverseScene( const GafferScene::ScenePlug *scenePlug, const Imath::Frustumf &frustum, const Imath::M44f &worldToFrustum )
+{
+	return culledTraverseSceneInternal( scenePlug, frustum, worldToFrustum );
+}
+
 Signals::Connection GafferSceneTest::connectTraverseSceneToPlugDirtiedSignal( const GafferScene::ConstScenePlugPtr &scene )
 {
 	const Node *node = scene->node();
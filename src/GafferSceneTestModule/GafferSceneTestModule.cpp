@@ -58,6 +58,13 @@ static void traverseSceneWrapper( const GafferScene::ScenePlug *scenePlug )
 	traverseScene( scenePlug );
 }
 
+template<typename Volume>
+static IECore::PathMatcher culledTraverseSceneWrapper( const GafferScene::ScenePlug *scenePlug, const Volume &volume, const Imath::M44f &worldToVolume )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return culledTraverseScene( scenePlug, volume, worldToVolume );
+}
+
 BOOST_PYTHON_MODULE( _GafferSceneTest )
 {
 
@@ -71,6 +78,9 @@ BOOST_PYTHON_MODULE( _GafferSceneTest )
 	GafferBindings::NodeClass<TestLightFilter>();
 
 	def( "traverseScene", &traverseSceneWrapper );
+	def( "culledTraverseScene", &culledTraverseSceneWrapper<Imath::Box3f>, ( arg( "scene" ), arg( "box" ), arg( "worldToBox" ) = Imath::M44f() ) );
+	def( "culledTraverseScene", &culledTraverseSceneWrapper<Imath::Line3f>, ( arg( "scene" ), arg( "ray" ), arg( "worldToRay" ) = Imath::M44f() ) );
+	def( "culledTraverseScene", &culledTraverseSceneWrapper<Imath::Frustumf>, ( arg( "scene" ), arg( "frustum" ), arg( "worldToFrustum" ) = Imath::M44f() ) );
 	def( "connectTraverseSceneToPlugDirtiedSignal", &connectTraverseSceneToPlugDirtiedSignal );
 	def( "connectTraverseSceneToContextChangedSignal", &connectTraverseSceneToContextChangedSignal );
 	def( "connectTraverseSceneToPreDispatchSignal", &connectTraverseSceneToPreDispatchSignal );
@@ -872,6 +872,24 @@ void SceneGadget::updateRenderer()
 
 		if( progress == BackgroundTask::Completed )
 		{
+			if( m_rendererName == "OpenGL" )
+			{
+				// Large objects are converted in the background, with
+				// their bounds drawn as placeholders in the meantime.
+				// Wait for them, so that the final redraw below
+				// includes them. We wait in short increments so that
+				// cancellation isn't blocked by slow conversions.
+				const IECore::Canceller *canceller = Context::current()->canceller();
+				const CompoundDataMap waitParameters = { { "timeout", new FloatData( 0.1f ) } };
+				while( !( canceller && canceller->cancelled() ) )
+				{
+					ConstBoolDataPtr complete = runTimeCast<const BoolData>( m_renderer->command( "gl:waitForConversions", waitParameters ) );
+					if( !complete || complete->readable() )
+					{
+						break;
+					}
+				}
+			}
 			// Start render now, rather than on UI thread, to avoid latency.
 			// We want pixels to be available as soon as possible.
 			if( m_camera )
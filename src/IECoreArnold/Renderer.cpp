@@ -413,11 +413,16 @@ class ArnoldRendererBase : public IECoreScenePreview::Renderer
 		ObjectInterfacePtr lightFilter( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		Renderer::ObjectInterfacePtr object( const std::string &name, const IECore::Object *object, const AttributesInterface *attributes ) override;
 		ObjectInterfacePtr object( const std::string &name, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const AttributesInterface *attributes ) override;
+		/// Converts the object only once, sharing it between all instances via `ginstance` nodes.
+		void instances( const std::vector<std::string> &names, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const std::vector<Imath::M44f> &transforms, const std::vector<float> &transformTimes, const AttributesInterface *attributes ) override;
 
 	protected :
 
 		ArnoldRendererBase( NodeDeleter nodeDeleter, AtUniverse *universe, AtNode *parentNode = nullptr, const IECore::MessageHandlerPtr &messageHandler = IECore::MessageHandlerPtr() );
 
+		/// Called by `instances()` for each instance it creates.
+		virtual void instanceCreated( const Instance &instance );
+
 		NodeDeleter m_nodeDeleter;
 		AtUniverse *m_universe;
 		ShaderCachePtr m_shaderCache;
@@ -2237,6 +2242,30 @@ class InstanceCache : public IECore::RefCounted
 			return Instance( node, m_nodeDeleter, m_universe, nodeName, m_parentNode );
 		}
 
+		// As for `get()`, but appending an instance for each of `nodeNames`.
+		// When the geometry can be instanced, it is only hashed and converted
+		// once, and shared by all the instances. If `times` is empty, `samples`
+		// must contain a single static object.
+		void get( const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const IECoreScenePreview::Renderer::AttributesInterface *attributes, const std::vector<std::string> &nodeNames, std::vector<Instance> &instances )
+		{
+			const ArnoldAttributes *arnoldAttributes = static_cast<const ArnoldAttributes *>( attributes );
+			const bool canInstance = arnoldAttributes->canInstanceGeometry( samples.front() );
+
+			const size_t firstIndex = instances.size();
+			instances.reserve( firstIndex + nodeNames.size() );
+			for( const auto &nodeName : nodeNames )
+			{
+				if( canInstance && instances.size() > firstIndex )
+				{
+					instances.push_back( Instance( instances[firstIndex].m_node, m_nodeDeleter, m_universe, nodeName, m_parentNode ) );
+				}
+				else
+				{
+					instances.push_back( times.empty() ? get( samples.front(), attributes, nodeName ) : get( samples, times, attributes, nodeName ) );
+				}
+			}
+		}
+
 		// Must not be called concurrently with anything.
 		void clearUnused()
 		{
@@ -3063,6 +3092,13 @@ class ProceduralRenderer final : public ArnoldRendererBase
 			m_shaderCache->nodesCreated( nodes );
 		}
 
+	protected :
+
+		void instanceCreated( const Instance &instance ) override
+		{
+			instance.nodesCreated( m_nodesCreated.local() );
+		}
+
 	private :
 
 		IECore::ConstCompoundObjectPtr m_attributesToInherit;
@@ -4305,6 +4341,47 @@ ArnoldRendererBase::ObjectInterfacePtr ArnoldRendererBase::object( const std::st
 	return result;
 }
 
+void ArnoldRendererBase::instances( const std::vector<std::string> &names, const std::vector<const IECore::Object *> &samples, const std::vector<float> &times, const std::vector<Imath::M44f> &transforms, const std::vector<float> &transformTimes, const AttributesInterface *attributes )
+{
+	const IECore::MessageHandler::Scope s( m_messageHandler.get() );
+
+	const size_t numTransformSamples = std::max<size_t>( 1, transformTimes.size() );
+	if( transforms.size() != names.size() * numTransformSamples )
+	{
+		throw IECore::Exception( "ArnoldRenderer::instances : Wrong number of transforms" );
+	}
+
+	if( names.empty() )
+	{
+		return;
+	}
+
+	vector<Instance> instances;
+	m_instanceCache->get( samples, times, attributes, names, instances );
+
+	vector<Imath::M44f> instanceTransforms;
+	for( size_t i = 0; i < instances.size(); ++i )
+	{
+		ObjectInterfacePtr object = new ArnoldObject( instances[i] );
+		object->attributes( attributes );
+		if( transformTimes.empty() )
+		{
+			object->transform( transforms[i] );
+		}
+		else
+		{
+			auto first = transforms.begin() + i * numTransformSamples;
+			instanceTransforms.assign( first, first + numTransformSamples );
+			object->transform( instanceTransforms, transformTimes );
+		}
+		instanceCreated( instances[i] );
+	}
+}
+
+void ArnoldRendererBase::instanceCreated( const Instance &instance )
+{
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////